@@ -76,6 +76,7 @@ namespace UnrealBuildTool.Rules
 
             if (TargetRules.bBuildEditor)
             {
+                PrivateDependencyModuleNames.Add("DeveloperToolSettings");
                 PrivateDependencyModuleNames.Add("SourceControl");
                 PrivateDependencyModuleNames.Add("UnrealEd");
             }
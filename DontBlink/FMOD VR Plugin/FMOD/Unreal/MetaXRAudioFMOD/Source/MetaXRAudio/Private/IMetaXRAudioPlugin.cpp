@@ -4,6 +4,9 @@
 #include "IMetaXRAudioPlugin.h"
 #include "AudioDevice.h"
 #include "Features/IModularFeatures.h"
+#include "MetaXRAcousticGeometryCache.h"
+#include "MetaXRAcousticGeometryPool.h"
+#include "MetaXRAcousticLevelManifest.h"
 #include "MetaXRAudioPlatform.h"
 #ifdef META_NATIVE_UNREAL_PLUGIN
 #include "MetaXRAudioContextManager.h"
@@ -11,6 +14,9 @@
 
 void FMetaXRAudioPlugin::StartupModule() {
   FMetaXRAudioLibraryManager::Get().Initialize();
+  FMetaXRAcousticGeometryPool::Get().Register();
+  FMetaXRAcousticGeometryCache::Get().Register();
+  FMetaXRAcousticLevelPrefetch::Get().Register();
 #ifdef META_NATIVE_UNREAL_PLUGIN
   IModularFeatures::Get().RegisterModularFeature(FMetaXRSpatializationPluginFactory::GetModularFeatureName(), &PluginFactory);
   IModularFeatures::Get().RegisterModularFeature(FMetaXRReverbPluginFactory::GetModularFeatureName(), &ReverbPluginFactory);
@@ -18,6 +24,10 @@ void FMetaXRAudioPlugin::StartupModule() {
 };
 
 void FMetaXRAudioPlugin::ShutdownModule() {
+  // Pooled handles must go before the library that owns them
+  FMetaXRAcousticGeometryPool::Get().Unregister();
+  FMetaXRAcousticGeometryCache::Get().Unregister();
+  FMetaXRAcousticLevelPrefetch::Get().Unregister();
   FMetaXRAudioLibraryManager::Get().Shutdown();
 }
 
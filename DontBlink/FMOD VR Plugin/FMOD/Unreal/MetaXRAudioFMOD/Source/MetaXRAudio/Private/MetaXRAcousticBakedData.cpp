@@ -0,0 +1,105 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#include "MetaXRAcousticBakedData.h"
+#include "MetaXRAcousticProjectSettings.h"
+#include "MetaXRAudioLogging.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+
+void UMetaXRAcousticBakedData::Serialize(FArchive& Ar) {
+  Super::Serialize(Ar);
+  BulkData.Serialize(Ar, this);
+}
+
+#if WITH_EDITOR
+void UMetaXRAcousticBakedData::PreSave(FObjectPreSaveContext ObjectSaveContext) {
+  Super::PreSave(ObjectSaveContext);
+
+  // Always cook the latest bake so a stale payload can never ship
+  if (ObjectSaveContext.IsCooking())
+    RefreshFromSourceFile();
+}
+
+bool UMetaXRAcousticBakedData::RefreshFromSourceFile() {
+  if (SourceFilePath.IsEmpty()) {
+    METAXR_AUDIO_LOG_WARNING("No source file path for acoustic baked data %s", *GetPathName());
+    return false;
+  }
+
+  const FString FullFilePath = FPaths::ProjectContentDir() / SourceFilePath;
+  TArray<uint8> FileData;
+  if (!FFileHelper::LoadFileToArray(FileData, *FullFilePath)) {
+    METAXR_AUDIO_LOG_WARNING("Failed to load acoustic baked file: %s", *FullFilePath);
+    return false;
+  }
+
+  BulkData.Lock(LOCK_READ_WRITE);
+  void* Dest = BulkData.Realloc(FileData.Num());
+  FMemory::Memcpy(Dest, FileData.GetData(), FileData.Num());
+  BulkData.Unlock();
+
+  METAXR_AUDIO_LOG("Stored %i bytes from %s in %s", FileData.Num(), *FullFilePath, *GetPathName());
+  return true;
+}
+
+// Payloads attached for a cook save, with the component and property holding each. Only touched on the game thread.
+struct FCookedBakedData {
+  TWeakObjectPtr<UObject> Owner;
+  TObjectPtr<UMetaXRAcousticBakedData>* BakedData = nullptr;
+};
+static TArray<FCookedBakedData> CookedBakedData;
+static FDelegateHandle PackageSavedHandle;
+
+static void DetachCookedBakedData(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext ObjectSaveContext) {
+  CookedBakedData.RemoveAll([Package](const FCookedBakedData& Cooked) {
+    const UObject* Owner = Cooked.Owner.Get();
+    if (Owner != nullptr && Owner->GetPackage() != Package)
+      return false;
+    // The payload is dropped rather than kept as an unreferenced subobject the next editor save would still write
+    if (Owner != nullptr && *Cooked.BakedData != nullptr) {
+      (*Cooked.BakedData)->SetFlags(RF_Transient);
+      (*Cooked.BakedData)->MarkAsGarbage();
+      *Cooked.BakedData = nullptr;
+    }
+    return true;
+  });
+}
+
+void UMetaXRAcousticBakedData::AttachForCook(
+    UObject* Owner,
+    const FString& FilePath,
+    TObjectPtr<UMetaXRAcousticBakedData>& BakedData,
+    const FObjectPreSaveContext& ObjectSaveContext) {
+  // Move the baked file into the level package so it ships and streams with the level
+  if (!ObjectSaveContext.IsCooking() || !GetDefault<UMetaXRAcousticProjectSettings>()->bCookBakedData || FilePath.IsEmpty())
+    return;
+
+  // Baked data assigned by hand lives in a package of its own and refreshes itself when that package is cooked
+  if (BakedData != nullptr && BakedData->GetOuter() != Owner)
+    return;
+  if (BakedData == nullptr)
+    BakedData = NewObject<UMetaXRAcousticBakedData>(Owner);
+  BakedData->SourceFilePath = FilePath;
+  if (!BakedData->RefreshFromSourceFile()) {
+    BakedData = nullptr;
+    return;
+  }
+
+  if (!PackageSavedHandle.IsValid())
+    PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddStatic(&DetachCookedBakedData);
+  CookedBakedData.Add({Owner, &BakedData});
+}
+#endif
+
+bool UMetaXRAcousticBakedData::ReadPayload(TFunctionRef<bool(const uint8* Data, int64 Size)> Reader) const {
+  const int64 Size = BulkData.GetBulkDataSize();
+  if (Size <= 0)
+    return false;
+
+  const uint8* Data = static_cast<const uint8*>(BulkData.LockReadOnly());
+  const bool bResult = Data != nullptr && Reader(Data, Size);
+  BulkData.Unlock();
+  return bResult;
+}
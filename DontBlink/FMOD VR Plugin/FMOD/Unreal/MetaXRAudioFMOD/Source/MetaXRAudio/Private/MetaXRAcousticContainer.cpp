@@ -0,0 +1,400 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#include "MetaXRAcousticContainer.h"
+#include "MetaXRAudioDllManager.h"
+#include "MetaXRAudioLogging.h"
+#include "MetaXRAudioSerializer.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+static void SerializeHeader(FArchive& Ar, FMetaXRAcousticContainer::FHeader& Header) {
+  Ar << Header.Magic;
+  Ar << Header.Version;
+  Ar.Serialize(Header.SourceHash, sizeof(Header.SourceHash));
+  Ar << Header.UncompressedSize;
+  Ar << Header.BlockSize;
+  Ar << Header.BlockCount;
+}
+
+static void SerializeBlock(FArchive& Ar, FMetaXRAcousticContainer::FBlock& Block) {
+  Ar << Block.CompressedSize;
+  Ar << Block.Crc;
+}
+
+// Reads or writes an array count, rejecting counts a loading archive cannot possibly hold
+template <typename ElementType>
+static bool SerializeCount(FArchive& Ar, TArray<ElementType>& Array) {
+  int32 Count = Array.Num();
+  Ar << Count;
+  if (Ar.IsLoading()) {
+    if (Count < 0 || Count > Ar.TotalSize()) {
+      Ar.SetError();
+      return false;
+    }
+    Array.SetNum(Count);
+  }
+  return true;
+}
+
+static void SerializeSections(FArchive& Ar, FMetaXRAcousticGeometrySections& Sections, const uint32 Version) {
+  if (!SerializeCount(Ar, Sections.Prototypes))
+    return;
+  for (FMetaXRAcousticPrototype& Prototype : Sections.Prototypes) {
+    Ar << Prototype.MeshData;
+    Ar << Prototype.Transforms;
+  }
+
+  if (Version < 3 || !SerializeCount(Ar, Sections.DistantLevels))
+    return;
+  for (FMetaXRAcousticDistantLevel& Level : Sections.DistantLevels) {
+    Ar << Level.Distance;
+    Ar << Level.MeshData;
+  }
+  Ar << Sections.Bounds;
+}
+
+static void HashSource(const FString& SourceHash, uint8 OutDigest[16]) {
+  const FTCHARToUTF8 Utf8(*SourceHash);
+  FMD5 Md5;
+  Md5.Update(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+  Md5.Final(OutDigest);
+}
+
+// Exposes the uncompressed payload of a container as a seekable ovrAudioSerializer, inflating one block at a time
+class FMetaXRAcousticContainer::FDecompressingSerializer {
+ public:
+  explicit FDecompressingSerializer(const ovrAudioSerializer& InSource) : Source(InSource) {}
+
+  // Reads the header and block table. The source must be positioned at the start of the container.
+  bool Open(const FString& ExpectedSourceHash) {
+    uint8 HeaderBytes[FHeader::SerializedSize];
+    if (!ReadSource(HeaderBytes, sizeof(HeaderBytes)))
+      return false;
+
+    FMemoryReaderView HeaderReader(MakeArrayView(HeaderBytes, sizeof(HeaderBytes)));
+    SerializeHeader(HeaderReader, Header);
+    if (Header.Magic != Magic || Header.Version > LatestVersion || Header.BlockSize == 0 ||
+        Header.BlockCount != FMath::DivideAndRoundUp<uint64>(Header.UncompressedSize, Header.BlockSize)) {
+      METAXR_AUDIO_LOG_WARNING("Invalid acoustic container header (version %u)", Header.Version);
+      return false;
+    }
+
+    // The source hash covers actor placement too, so a moved actor or a Blueprint instance sharing its template's file differs
+    // from its bake. The data is still usable, so a mismatch only flags the file as needing a rebake.
+    if (!ExpectedSourceHash.IsEmpty()) {
+      uint8 ExpectedDigest[16];
+      HashSource(ExpectedSourceHash, ExpectedDigest);
+      if (FMemory::Memcmp(ExpectedDigest, Header.SourceHash, sizeof(ExpectedDigest)) != 0)
+        METAXR_AUDIO_LOG_WARNING("Acoustic container was baked from different source data, it needs to be rebaked");
+    }
+
+    TArray<uint8> TableBytes;
+    TableBytes.SetNumUninitialized(Header.BlockCount * FBlock::SerializedSize);
+    if (!ReadSource(TableBytes.GetData(), TableBytes.Num()))
+      return false;
+
+    FMemoryReader TableReader(TableBytes);
+    Blocks.SetNum(Header.BlockCount);
+    BlockOffsets.SetNum(Header.BlockCount);
+    int64 Offset = SourcePos;
+    for (uint32 BlockIndex = 0; BlockIndex < Header.BlockCount; ++BlockIndex) {
+      SerializeBlock(TableReader, Blocks[BlockIndex]);
+      BlockOffsets[BlockIndex] = Offset;
+      Offset += Blocks[BlockIndex].CompressedSize;
+    }
+    return true;
+  }
+
+  ovrAudioSerializer GetSerializer() {
+    ovrAudioSerializer Serializer;
+    Serializer.read = Read;
+    Serializer.write = nullptr;
+    Serializer.seek = Seek;
+    Serializer.userData = this;
+    return Serializer;
+  }
+
+  int64 GetUncompressedSize() const {
+    return static_cast<int64>(Header.UncompressedSize);
+  }
+
+  // Size of the leading SDK data; version 1 payloads are nothing but SDK data
+  bool GetSdkDataSize(int64& OutSize) {
+    OutSize = GetUncompressedSize();
+    if (Header.Version < 2)
+      return true;
+
+    uint64 SdkDataSize = 0;
+    if (GetUncompressedSize() < static_cast<int64>(sizeof(SdkDataSize)))
+      return false;
+    if (!ReadAt(GetUncompressedSize() - sizeof(SdkDataSize), &SdkDataSize, sizeof(SdkDataSize)) ||
+        SdkDataSize > static_cast<uint64>(GetUncompressedSize()) - sizeof(SdkDataSize))
+      return false;
+
+    OutSize = static_cast<int64>(SdkDataSize);
+    return true;
+  }
+
+  bool ReadSections(FMetaXRAcousticGeometrySections& OutSections) {
+    OutSections = FMetaXRAcousticGeometrySections();
+    int64 SdkDataSize = 0;
+    if (!GetSdkDataSize(SdkDataSize))
+      return false;
+
+    const int64 SectionSize = GetUncompressedSize() - static_cast<int64>(sizeof(uint64)) - SdkDataSize;
+    if (Header.Version < 2 || SectionSize <= 0)
+      return true;
+
+    TArray<uint8> Section;
+    Section.SetNumUninitialized(SectionSize);
+    if (!ReadAt(SdkDataSize, Section.GetData(), SectionSize))
+      return false;
+
+    FMemoryReader Reader(Section);
+    SerializeSections(Reader, OutSections, Header.Version);
+    return !Reader.IsError();
+  }
+
+  bool ReadAt(int64 Offset, void* Dest, int64 Count) {
+    Pos = Offset;
+    return Read(this, Dest, Count) == static_cast<size_t>(Count);
+  }
+
+ private:
+  bool ReadSource(void* Dest, int64 Count) {
+    if (Source.read(Source.userData, Dest, Count) != static_cast<size_t>(Count))
+      return false;
+    SourcePos += Count;
+    return true;
+  }
+
+  bool LoadBlock(int32 BlockIndex) {
+    if (BlockIndex == LoadedBlock)
+      return true;
+
+    const int64 SeekDelta = BlockOffsets[BlockIndex] - SourcePos;
+    if (SeekDelta != 0) {
+      if (Source.seek == nullptr || Source.seek(Source.userData, SeekDelta) != SeekDelta)
+        return false;
+      SourcePos += SeekDelta;
+    }
+
+    const FBlock& Block = Blocks[BlockIndex];
+    const int64 BlockStart = static_cast<int64>(BlockIndex) * Header.BlockSize;
+    const int32 UncompressedSize = static_cast<int32>(FMath::Min<int64>(Header.BlockSize, GetUncompressedSize() - BlockStart));
+    Decompressed.SetNumUninitialized(UncompressedSize);
+    LoadedBlock = INDEX_NONE;
+
+    if (Block.CompressedSize == static_cast<uint32>(UncompressedSize)) {
+      // Stored raw because compression didn't help
+      if (!ReadSource(Decompressed.GetData(), UncompressedSize))
+        return false;
+    } else {
+      Compressed.SetNumUninitialized(Block.CompressedSize);
+      if (!ReadSource(Compressed.GetData(), Block.CompressedSize))
+        return false;
+      if (!FCompression::UncompressMemory(NAME_LZ4, Decompressed.GetData(), UncompressedSize, Compressed.GetData(), Compressed.Num())) {
+        METAXR_AUDIO_LOG_WARNING("Failed to decompress acoustic container block %i", BlockIndex);
+        return false;
+      }
+    }
+
+    if (FCrc::MemCrc32(Decompressed.GetData(), UncompressedSize) != Block.Crc) {
+      METAXR_AUDIO_LOG_WARNING("Acoustic container block %i failed its integrity check", BlockIndex);
+      return false;
+    }
+
+    LoadedBlock = BlockIndex;
+    return true;
+  }
+
+  static size_t Read(void* userData, void* bytes, size_t byteCount) {
+    FDecompressingSerializer* Self = static_cast<FDecompressingSerializer*>(userData);
+    if (Self->Pos + static_cast<int64>(byteCount) > Self->GetUncompressedSize())
+      return 0;
+
+    uint8* Dest = static_cast<uint8*>(bytes);
+    int64 Remaining = static_cast<int64>(byteCount);
+    while (Remaining > 0) {
+      const int32 BlockIndex = static_cast<int32>(Self->Pos / Self->Header.BlockSize);
+      if (!Self->LoadBlock(BlockIndex))
+        return 0;
+
+      const int64 OffsetInBlock = Self->Pos - static_cast<int64>(BlockIndex) * Self->Header.BlockSize;
+      const int64 Count = FMath::Min<int64>(Remaining, Self->Decompressed.Num() - OffsetInBlock);
+      FMemory::Memcpy(Dest, Self->Decompressed.GetData() + OffsetInBlock, Count);
+      Dest += Count;
+      Self->Pos += Count;
+      Remaining -= Count;
+    }
+    return byteCount;
+  }
+
+  static int64_t Seek(void* userData, int64_t seekOffset) {
+    FDecompressingSerializer* Self = static_cast<FDecompressingSerializer*>(userData);
+    const int64 Start = Self->Pos;
+    Self->Pos = FMath::Clamp<int64>(Start + seekOffset, 0, Self->GetUncompressedSize());
+    return Self->Pos - Start;
+  }
+
+  ovrAudioSerializer Source;
+  int64 SourcePos = 0;
+  FHeader Header;
+  TArray<FBlock> Blocks;
+  TArray<int64> BlockOffsets;
+  TArray<uint8> Compressed;
+  TArray<uint8> Decompressed;
+  int32 LoadedBlock = INDEX_NONE;
+  int64 Pos = 0;
+};
+
+bool FMetaXRAcousticContainer::IsContainer(const uint8* Data, int64 Size) {
+  uint32 FileMagic = 0;
+  if (Data == nullptr || Size < FHeader::SerializedSize)
+    return false;
+  FMemory::Memcpy(&FileMagic, Data, sizeof(FileMagic));
+  return FileMagic == Magic;
+}
+
+bool FMetaXRAcousticContainer::Compress(
+    const uint8* InData,
+    int64 InSize,
+    const FString& SourceHash,
+    TArray<uint8>& OutContainer,
+    const FMetaXRAcousticGeometrySections& Sections) {
+  // SDK data, sections, then the SDK data size so readers can find the sections
+  TArray<uint8> Uncompressed;
+  Uncompressed.Reserve(InSize + 64);
+  Uncompressed.Append(InData, InSize);
+  FMemoryWriter SectionWriter(Uncompressed, false, true);
+  // Saving archives only read from what they serialize
+  SerializeSections(SectionWriter, const_cast<FMetaXRAcousticGeometrySections&>(Sections), LatestVersion);
+  uint64 SdkDataSize = InSize;
+  SectionWriter << SdkDataSize;
+  if (SectionWriter.IsError())
+    return false;
+
+  const uint8* Data = Uncompressed.GetData();
+  const int64 Size = Uncompressed.Num();
+
+  FHeader Header;
+  Header.Magic = Magic;
+  Header.Version = LatestVersion;
+  HashSource(SourceHash, Header.SourceHash);
+  Header.UncompressedSize = Size;
+  Header.BlockSize = DefaultBlockSize;
+  Header.BlockCount = FMath::DivideAndRoundUp<uint64>(Size, DefaultBlockSize);
+
+  TArray<FBlock> Blocks;
+  TArray<uint8> Payload;
+  Blocks.SetNum(Header.BlockCount);
+  Payload.Reserve(Size / 2);
+  TArray<uint8> Scratch;
+  Scratch.SetNumUninitialized(FCompression::CompressMemoryBound(NAME_LZ4, DefaultBlockSize));
+  for (uint32 BlockIndex = 0; BlockIndex < Header.BlockCount; ++BlockIndex) {
+    const uint8* BlockData = Data + static_cast<int64>(BlockIndex) * DefaultBlockSize;
+    const int32 BlockSize = static_cast<int32>(FMath::Min<int64>(DefaultBlockSize, Size - static_cast<int64>(BlockIndex) * DefaultBlockSize));
+    Blocks[BlockIndex].Crc = FCrc::MemCrc32(BlockData, BlockSize);
+
+    int32 CompressedSize = Scratch.Num();
+    const bool bCompressed =
+        FCompression::CompressMemory(NAME_LZ4, Scratch.GetData(), CompressedSize, BlockData, BlockSize) && CompressedSize < BlockSize;
+    if (bCompressed) {
+      Payload.Append(Scratch.GetData(), CompressedSize);
+    } else {
+      CompressedSize = BlockSize;
+      Payload.Append(BlockData, BlockSize);
+    }
+    Blocks[BlockIndex].CompressedSize = CompressedSize;
+  }
+
+  OutContainer.Reset(FHeader::SerializedSize + Blocks.Num() * FBlock::SerializedSize + Payload.Num());
+  FMemoryWriter Writer(OutContainer);
+  SerializeHeader(Writer, Header);
+  for (FBlock& Block : Blocks)
+    SerializeBlock(Writer, Block);
+  Writer.Serialize(Payload.GetData(), Payload.Num());
+  return !Writer.IsError();
+}
+
+bool FMetaXRAcousticContainer::CompressFile(
+    const FString& FullFilePath,
+    const FString& SourceHash,
+    const FMetaXRAcousticGeometrySections& Sections) {
+  TArray<uint8> RawData;
+  if (!FFileHelper::LoadFileToArray(RawData, *FullFilePath)) {
+    METAXR_AUDIO_LOG_WARNING("Unable to read %s for compression", *FullFilePath);
+    return false;
+  }
+  if (IsContainer(RawData.GetData(), RawData.Num()))
+    return true;
+
+  TArray<uint8> Container;
+  if (!Compress(RawData.GetData(), RawData.Num(), SourceHash, Container, Sections) ||
+      !FFileHelper::SaveArrayToFile(Container, *FullFilePath)) {
+    METAXR_AUDIO_LOG_WARNING("Unable to write compressed acoustic data to %s", *FullFilePath);
+    return false;
+  }
+
+  METAXR_AUDIO_LOG("Compressed %s from %i to %i bytes", *FullFilePath, RawData.Num(), Container.Num());
+  return true;
+}
+
+ovrResult FMetaXRAcousticContainer::ReadGeometry(
+    ovrAudioGeometry Geometry,
+    const ovrAudioSerializer& Source,
+    FMetaXRAcousticGeometrySections* OutSections,
+    const FString& ExpectedSourceHash) {
+  if (OutSections)
+    *OutSections = FMetaXRAcousticGeometrySections();
+
+  // Peek at the magic, then rewind so either reader starts at the beginning
+  uint32 FileMagic = 0;
+  if (Source.read(Source.userData, &FileMagic, sizeof(FileMagic)) != sizeof(FileMagic))
+    return ovrError_AudioInvalidParam;
+  if (Source.seek(Source.userData, -static_cast<int64_t>(sizeof(FileMagic))) != -static_cast<int64_t>(sizeof(FileMagic)))
+    return ovrError_AudioInvalidParam;
+
+  if (FileMagic != Magic)
+    return OVRA_CALL(ovrAudio_AudioGeometryReadMeshData)(Geometry, &Source);
+
+  FDecompressingSerializer Decompressor(Source);
+  if (!Decompressor.Open(ExpectedSourceHash))
+    return ovrError_AudioInvalidParam;
+
+  const ovrAudioSerializer Serializer = Decompressor.GetSerializer();
+  const ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometryReadMeshData)(Geometry, &Serializer);
+  if (Result != ovrSuccess || OutSections == nullptr)
+    return Result;
+
+  if (!Decompressor.ReadSections(*OutSections)) {
+    METAXR_AUDIO_LOG_WARNING("Invalid geometry sections in acoustic container");
+    return ovrError_AudioInvalidParam;
+  }
+  return ovrSuccess;
+}
+
+ovrResult FMetaXRAcousticContainer::ReadSceneIR(ovrAudioSceneIR SceneIR, const uint8* Data, int64 Size, const FString& ExpectedSourceHash) {
+  if (!IsContainer(Data, Size))
+    return OVRA_CALL(ovrAudio_AudioSceneIRReadMemory)(SceneIR, (const int8_t*)Data, Size);
+
+  FMetaXRAudioMemorySerializer MemorySerializer(Data, Size);
+  FDecompressingSerializer Decompressor(MemorySerializer.GetSerializer());
+  if (!Decompressor.Open(ExpectedSourceHash))
+    return ovrError_AudioInvalidParam;
+
+  int64 SdkDataSize = 0;
+  if (!Decompressor.GetSdkDataSize(SdkDataSize))
+    return ovrError_AudioInvalidParam;
+
+  TArray<uint8> Uncompressed;
+  Uncompressed.SetNumUninitialized(SdkDataSize);
+  if (!Decompressor.ReadAt(0, Uncompressed.GetData(), SdkDataSize))
+    return ovrError_AudioInvalidParam;
+
+  return OVRA_CALL(ovrAudio_AudioSceneIRReadMemory)(SceneIR, (const int8_t*)Uncompressed.GetData(), Uncompressed.Num());
+}
@@ -0,0 +1,101 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MetaXR_Audio.h"
+#include "MetaXR_Audio_AcousticRayTracing.h"
+
+// A mesh that was simplified once and is placed once per instance instead of being merged into the main geometry
+struct FMetaXRAcousticPrototype {
+  // SDK geometry data in the prototype's own local space (OVR axes)
+  TArray<uint8> MeshData;
+  // Each instance's UE local-to-geometry-component matrix
+  TArray<FMatrix44f> Transforms;
+};
+
+// A coarser simplification of the whole geometry, used once the listener is at least Distance away
+struct FMetaXRAcousticDistantLevel {
+  // Centimeters from the geometry's bounds
+  float Distance = 0.0f;
+  // SDK geometry data in the same space as the main geometry data
+  TArray<uint8> MeshData;
+};
+
+// What a container stores next to the SDK geometry data
+struct FMetaXRAcousticGeometrySections {
+  TArray<FMetaXRAcousticPrototype> Prototypes;
+  // Nearest first
+  TArray<FMetaXRAcousticDistantLevel> DistantLevels;
+  // UE component-space bounds of the geometry, for measuring the distance to the listener
+  FBox3f Bounds = FBox3f(ForceInit);
+
+  bool IsEmpty() const {
+    return Prototypes.IsEmpty() && DistantLevels.IsEmpty();
+  }
+};
+
+// Compressed wrapper around the files the SDK writes for acoustic geometry (.xrageo) and acoustic maps (.xramap).
+//
+//   FHeader
+//   FBlock[BlockCount]                  compressed size and CRC32 of each uncompressed block
+//   block payloads                      LZ4, or stored raw when a block doesn't shrink
+//
+// Every block but the last decompresses to BlockSize bytes, so readers can seek without inflating what they skip.
+// Files without the magic are legacy raw SDK output and are read unchanged.
+//
+// From version 2 the uncompressed payload is the SDK data followed by the instanced prototype section, with the size of the SDK
+// data as a trailing uint64 so readers can find the section without parsing the SDK data. Version 3 appends the distant levels
+// and bounds to that section.
+class FMetaXRAcousticContainer {
+ public:
+  static constexpr uint32 Magic = 0x43415258; // "XRAC"
+  static constexpr uint32 LatestVersion = 3;
+  static constexpr uint32 DefaultBlockSize = 256 * 1024;
+
+  struct FHeader {
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    // MD5 of the content hash (geometry hierarchy hash or map scene hash) the payload was baked from
+    uint8 SourceHash[16] = {};
+    uint64 UncompressedSize = 0;
+    uint32 BlockSize = 0;
+    uint32 BlockCount = 0;
+
+    static constexpr int64 SerializedSize = 40;
+  };
+
+  struct FBlock {
+    uint32 CompressedSize = 0;
+    uint32 Crc = 0;
+
+    static constexpr int64 SerializedSize = 8;
+  };
+
+  static bool IsContainer(const uint8* Data, int64 Size);
+
+  static bool Compress(
+      const uint8* Data,
+      int64 Size,
+      const FString& SourceHash,
+      TArray<uint8>& OutContainer,
+      const FMetaXRAcousticGeometrySections& Sections = {});
+  // Replaces a raw SDK file with its compressed container. Files that are already containers are left alone.
+  static bool CompressFile(const FString& FullFilePath, const FString& SourceHash, const FMetaXRAcousticGeometrySections& Sections = {});
+
+  // Parse geometry from a raw or container stream. Container payloads are inflated one block at a time.
+  // The sections stored alongside the geometry are returned through OutSections when given.
+  // A container baked from a source hash other than ExpectedSourceHash is logged as needing a rebake but still read. An empty
+  // hash skips the check, as do raw files, which carry no hash.
+  static ovrResult ReadGeometry(
+      ovrAudioGeometry Geometry,
+      const ovrAudioSerializer& Source,
+      FMetaXRAcousticGeometrySections* OutSections = nullptr,
+      const FString& ExpectedSourceHash = FString());
+  // Parse an acoustic map from a raw or container block of memory. The scene IR API has no streaming entry point, so
+  // container payloads are inflated into a temporary buffer first. ExpectedSourceHash is checked as in ReadGeometry.
+  static ovrResult ReadSceneIR(ovrAudioSceneIR SceneIR, const uint8* Data, int64 Size, const FString& ExpectedSourceHash = FString());
+
+ private:
+  class FDecompressingSerializer;
+};
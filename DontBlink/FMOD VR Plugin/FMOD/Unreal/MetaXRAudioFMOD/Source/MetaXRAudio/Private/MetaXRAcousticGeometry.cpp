@@ -1,26 +1,47 @@
 // (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
 // Copyright Epic Games, Inc. All Rights Reserved.
 #include "MetaXRAcousticGeometry.h"
+#include "Algo/Sort.h"
+#include "Async/Async.h"
+#include "Async/AsyncFileHandle.h"
+#include "Async/ParallelFor.h"
 #include "AudioDevice.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Engine/StaticMesh.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerStart.h"
+#include "HAL/PlatformFileManager.h"
 #include "IMetaXRAudioPlugin.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Landscape.h"
-#include "LandscapeComponent.h"
-#include "LandscapeDataAccess.h"
-#include "LandscapeInfo.h"
+#include "LandscapeHeightfieldCollisionComponent.h"
 #include "Materials/MaterialInstanceDynamic.h"
+#include "MetaXRAcousticBakedData.h"
+#include "MetaXRAcousticContainer.h"
+#include "MetaXRAcousticGeometryCache.h"
+#include "MetaXRAcousticGeometryChunk.h"
+#include "MetaXRAcousticGeometryPool.h"
+#include "MetaXRAcousticHeightfield.h"
+#include "MetaXRAcousticLevelManifest.h"
 #include "MetaXRAcousticMaterial.h"
+#include "MetaXRAcousticMaterialPool.h"
+#include "MetaXRAcousticMeshLayout.h"
 #include "MetaXRAcousticProjectSettings.h"
 #include "MetaXRAudioContext.h"
+#include "MetaXRAudioSerializer.h"
 #include "MetaXRAudioUtilities.h"
-#include "Misc/FileHelper.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
+#include "PhysicsEngine/BodySetup.h"
 #include "Runtime/Core/Public/Serialization/CustomVersion.h"
+#include "UObject/StrongObjectPtr.h"
 #if WITH_EDITORONLY_DATA
 #include "Selection.h"
 #endif
+#if WITH_EDITOR
+#include "UObject/ObjectSaveContext.h"
+#endif
 #include "Misc/EngineVersionComparison.h"
 #include "StaticMeshResources.h"
 #if UE_VERSION_OLDER_THAN(5, 2, 0)
@@ -45,6 +66,73 @@ static const FCustomVersionRegistration UMetaXRAcousticGeometryGUIDRegistration(
     UE_ACOUSTIC_GEOMETRY_COMPONENT_LATEST_VERSION,
     TEXT("MetaXRAcousticGeometryVersion"));
 
+// Geometry handles placed from simplified-once prototypes. The prototypes are kept so a later bake of the live geometry can
+// write them back out.
+struct FAcousticGeometryInstances {
+  struct FInstance {
+    ovrAudioGeometry Geometry;
+    // UE local-to-component matrix
+    FMatrix LocalMatrix;
+  };
+
+  TArray<FInstance> Geometries;
+  TArray<FMetaXRAcousticPrototype> Prototypes;
+};
+
+// Handles of the coarser levels baked alongside the geometry. Level 0 is the geometry itself (with its instances); level i
+// is Geometries[i - 1]. The baked levels are kept so a later bake of the live geometry can write them back out.
+struct FAcousticGeometryLevels {
+  TArray<ovrAudioGeometry> Geometries;
+  TArray<FMetaXRAcousticDistantLevel> Levels;
+  // UE component-space bounds the listener distance is measured to
+  FBox3f Bounds;
+  int32 ActiveLevel = 0;
+};
+
+// One handle per landscape collision component, decimated from its heightfield at startup rather than baked, so landscapes are
+// present at runtime and each tile can be switched on and off by itself
+struct FAcousticGeometryLandscapeTiles {
+  struct FTile {
+    ovrAudioGeometry Geometry;
+    FIntPoint SectionBase;
+    bool bEnabled = true;
+  };
+
+  TArray<FTile> Tiles;
+  // References into the shared material pool held for as long as the tiles exist
+  TArray<ovrAudioMaterial> Materials;
+};
+
+// Landscape tiles sampled from their collision heightfields on the game thread and decimated on a worker, uploaded by
+// FinishLandscapeTiles. The worker only reads the copied heights, so the landscape is free to stream out under it.
+struct FAcousticGeometryLandscapeBuild {
+  struct FTileMesh {
+    FString ComponentName;
+    FIntPoint SectionBase = FIntPoint::ZeroValue;
+    int32 CollisionSizeQuads = 0;
+    float CollisionScale = 1.0f;
+    const UMetaXRAcousticMaterialProperties* Material = nullptr;
+    FTransform Transform;
+    TArray<float> Heights;
+    TArray<FVector3f> Vertices;
+    TArray<uint32> Indices;
+    bool bSampled = false;
+  };
+
+  TArray<FTileMesh> TileMeshes;
+  std::atomic<bool> bCancelled{false};
+};
+
+// Which of the upload paths a gathered mesh takes
+enum class EMeshUploadPath : uint8 { Merged, Collision, Prototype, Proxy };
+
+// The component settings that decide each mesh's upload path
+struct FMeshUploadOptions {
+  EMetaXRAcousticInstanceProxy InstanceProxy = EMetaXRAcousticInstanceProxy::None;
+  bool bSimplifyInstancesOnce = false;
+  bool bUseSimpleCollision = false;
+};
+
 // Forward declare hidden function
 ovrResult ovrAudio_AudioGeometrySetObjectFlag(ovrAudioGeometry geometry, ovrAudioObjectFlags flag, int32_t enabled);
 
@@ -53,8 +141,13 @@ ovrResult ovrAudio_AudioGeometrySetObjectFlag(ovrAudioGeometry geometry, ovrAudi
 
 class FAcousticGeoGizmoData {
  public:
-  void UpdateGizmoMeshData(ovrAudioGeometry GeometryHandle);
-  void MapGizmoMaterials(UMetaXRAcousticGeometry::FMeshGatherer& Gatherer);
+  // bMeshSpace: the geometry's vertices were uploaded in UE axes and need no conversion back
+  void UpdateGizmoMeshData(ovrAudioGeometry GeometryHandle, bool bMeshSpace);
+  // Mesh groups are laid out as merged meshes, then collision meshes, then instance proxies, then landscapes
+  void MapGizmoMaterials(
+      UMetaXRAcousticGeometry::FMeshGatherer& Gatherer,
+      const FMeshUploadOptions& Options,
+      TFunctionRef<UMetaXRAcousticMaterialProperties*(const AcousticMesh&)> GetProxyMaterial);
 
   const TArray<FDynamicMeshVertex>& GetGizmoVertexData() const;
   const TMap<UMetaXRAcousticMaterialProperties*, TArray<uint32>>& GetGizmoMaterialData() const;
@@ -156,7 +249,9 @@ void UMetaXRAcousticGeometry::RefreshNeedsRebaked() {
   // The AgeChecker traversal can take a long time. Call it just once when GUI is enabled.
   FAgeChecker AgeChecker(TimeStamp, bUsePhysicalMaterials, bIncludeChildren);
   TraverseHierarchy(AgeChecker);
-  bNeedsRebake = AgeChecker.IsStale() || AgeChecker.GetHash() != HierarchyHash;
+  TraverseChunkSources(AgeChecker);
+  // Files baked before landscapes were built as tiles still hold them, which only a rebake takes out
+  bNeedsRebake = AgeChecker.IsStale() || AgeChecker.GetHash() != HierarchyHash || (AgeChecker.HasLandscapes() && !bFileExcludesLandscapes);
 }
 #endif
 
@@ -241,6 +336,7 @@ void UMetaXRAcousticGeometry::CheckGeoTransformValid() {
 FString UMetaXRAcousticGeometry::ComputeHash() const {
   FHashAppender HashAppender(bUsePhysicalMaterials, bIncludeChildren);
   TraverseHierarchy(HashAppender);
+  TraverseChunkSources(HashAppender);
   return HashAppender.GetHash();
 }
 
@@ -261,6 +357,12 @@ void UMetaXRAcousticGeometry::OnUnregister() {
 void UMetaXRAcousticGeometry::BeginPlay() {
   Super::BeginPlay();
 
+  // The level's geometry chunks load this geometry's meshes
+  if (bMergedIntoChunk) {
+    SetComponentTickEnabled(false);
+    return;
+  }
+
   if (!StartInternal()) {
     METAXR_AUDIO_LOG_ERROR("Failed to initialize Acoustic Geometry. Destroying this component...");
     DestroyComponent(true);
@@ -272,9 +374,10 @@ void UMetaXRAcousticGeometry::BeginPlay() {
   // For visualizing acoustic geo in editor + playmode
   InitGizmoData();
 #else
-  // Tick is only used for Moveable acoustic geo or if we are in editor (visualization gizmo)
+  // Tick is only used for Moveable acoustic geo, distance-switched error levels or if we are in editor (visualization gizmo).
+  // Files still loading turn it on once they turn out to have levels.
   const bool IsMovable = !IsStatic();
-  SetComponentTickEnabled(IsMovable);
+  SetComponentTickEnabled(IsMovable || Levels.IsValid());
 #endif
 }
 
@@ -284,6 +387,9 @@ bool UMetaXRAcousticGeometry::StartInternal() {
     return false;
   }
   ApplyTransform();
+  // File loads in playmode and movable uploads complete asynchronously and mark themselves ready
+  if (!PendingLoad.IsValid() && !PendingUpload.IsValid())
+    MarkGeometryReady();
   return true;
 }
 
@@ -305,6 +411,20 @@ bool UMetaXRAcousticGeometry::CreatePropagationGeometry() {
     return false;
   }
 
+  // Pooled geometry takes over the handle an earlier spawn left behind
+  if (bPoolGeometry && IsPlaymodeActive()) {
+    PoolKey = GetPoolKey();
+    OvrGeometry = FMetaXRAcousticGeometryPool::Get().Acquire(CachedContext, PoolKey, PooledMaterials, bMeshSpaceUpload);
+    if (OvrGeometry != nullptr) {
+      METAXR_AUDIO_LOG("Reusing pooled geometry handle %p", OvrGeometry);
+      // Placed before it is enabled, so it doesn't show up where the last spawn despawned
+      ApplyTransform();
+      SetGeometryEnabled(IsActive());
+      OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(OvrGeometry, ovrAudioObjectFlag_Static, IsStatic());
+      return true;
+    }
+  }
+
   // our internal geometry object into which we'll merge this static mesh actor and all its attached meshes
   ovrResult Result = OVRA_CALL(ovrAudio_CreateAudioGeometry)(CachedContext, &OvrGeometry);
   if (Result != ovrSuccess) {
@@ -314,6 +434,7 @@ bool UMetaXRAcousticGeometry::CreatePropagationGeometry() {
     METAXR_AUDIO_LOG("Created new geometry handle %p", OvrGeometry);
   }
 
+  bool bReadFile = false;
 #if WITH_EDITOR
   if (!IsPlaymodeActive()) {
     // If this is startup during project startup, try loading an existing file before uploading because we don't have access to child meshes
@@ -321,15 +442,20 @@ bool UMetaXRAcousticGeometry::CreatePropagationGeometry() {
     bool FileReadSuccessfully = false;
     if (bFileEnabled)
       FileReadSuccessfully = ReadFile();
+    bReadFile = FileReadSuccessfully;
 
-    if (!FileReadSuccessfully && !UploadMesh(OvrGeometry))
-      return false;
+    if (!FileReadSuccessfully) {
+      TArray<FMetaXRAcousticPrototype> Prototypes;
+      if (!UploadMesh(OvrGeometry, &Prototypes) || !CreateInstanceGeometries(MoveTemp(Prototypes)))
+        return false;
+    }
   } else
 #endif
       if (bFileEnabled) {
     if (!ReadFile()) {
       return false;
     }
+    bReadFile = true;
   } else {
     if (IsStatic()) {
       METAXR_AUDIO_LOG_WARNING("Static geometry requires \"File Enabled\"");
@@ -339,6 +465,10 @@ bool UMetaXRAcousticGeometry::CreatePropagationGeometry() {
     }
   }
 
+  // Landscapes aren't part of the file or the upload; a missing tile shouldn't cost the rest of the geometry
+  if (!CreateLandscapeTiles(bReadFile && !bFileExcludesLandscapes))
+    METAXR_AUDIO_LOG_WARNING("Failed to create the landscape tiles of %s", *GetReadableName());
+
   return true;
 }
 
@@ -359,11 +489,12 @@ void UMetaXRAcousticGeometry::TickComponent(float DeltaTime, enum ELevelTick Tic
 #endif
 
   // Update the transform when changed during runtime
-  if (OvrGeometry != nullptr) {
+  if (OvrGeometry != nullptr && !PendingLoad.IsValid()) {
     const FTransform& Transform = GetComponentTransform();
     const bool NeedsApplyTransform = !Transform.Equals(PreviousTransform) || (PreviousGeometry != OvrGeometry);
     if (NeedsApplyTransform)
       ApplyTransform();
+    UpdateActiveLevel();
 
 #if WITH_EDITOR_GIZMOS
     if (NeedsApplyTransform && !IsPlaymodeActive())
@@ -373,23 +504,6 @@ void UMetaXRAcousticGeometry::TickComponent(float DeltaTime, enum ELevelTick Tic
 }
 
 #pragma region MESH_UPLOAD
-// ------------------------------------------------------------------------------------------------------------------------------------------------------------
-bool UMetaXRAcousticGeometry::UploadGeometry() {
-  int IgnoredMeshCount = 0;
-  if (!UploadMesh(OvrGeometry, GetOwner(), IsPlaymodeActive(), IgnoredMeshCount))
-    return false;
-
-  if (IgnoredMeshCount != 0) {
-    METAXR_AUDIO_LOG_WARNING(
-        "Failed to upload meshes, %i static meshes ignored. Turn on \"File Enabled\" to process static meshes offline", IgnoredMeshCount);
-  }
-
-#if WITH_EDITOR
-  UpdateGizmoMesh(OvrGeometry);
-#endif
-  return true;
-}
-
 static void UpdateCountsForMesh(
     int32& TotalVertexCount,
     uint32& TotalIndexCount,
@@ -415,56 +529,593 @@ static void UpdateCountsForMesh(
   TotalMaterialCount += InstanceCount * Mesh->GetNumSections(LodGroupToUse);
 }
 
-#if WITH_EDITOR
-static void UpdateCountsForLandscape(
-    int32& TotalVertexCount,
-    uint32& TotalIndexCount,
-    int32& TotalFaceCount,
-    int32& TotalMaterialCount,
-    ULandscapeInfo* LandscapeInfo) {
-  if (!LandscapeInfo)
-    return;
+// A slice of one mesh (or one instance of an instanced mesh) to be transformed into the merged arrays. Slices write disjoint
+// ranges, so they can all run in parallel once the offsets have been planned.
+struct FMeshTransformJob {
+  const FStaticMeshLODResources* Model;
+  // Mesh-local to geometry-local, with the UE to OVR axis swap folded in
+  FMatrix Matrix;
+  int32 VertexOffset;
+  int32 IndexOffset;
+  int32 FirstVertex;
+  int32 NumVertices;
+  int32 FirstIndex;
+  int32 NumIndices;
+};
+
+// Keeps large meshes from becoming a single long task while not making tiny ones pay for scheduling
+static constexpr int32 MeshTransformJobSize = 16 * 1024;
+
+// The merged arrays handed to the SDK. Positions are staged in single precision since the SDK quantizes to meters anyway, and
+// indices drop to 16 bits whenever every merged vertex is addressable with them. Only one of the index arrays is ever filled.
+struct FMeshStagingArrays {
+  TArray<FVector3f> Vertices;
+  TArray<uint16> Indices16;
+  TArray<uint32> Indices32;
+
+  void Init(int32 VertexCount, int32 IndexCount) {
+    Vertices.SetNumUninitialized(VertexCount);
+    if (Uses16BitIndices())
+      Indices16.SetNumUninitialized(IndexCount);
+    else
+      Indices32.SetNumUninitialized(IndexCount);
+  }
+
+  bool Uses16BitIndices() const {
+    return Vertices.Num() <= MAX_uint16 + 1;
+  }
+
+  void SetIndex(int32 Index, uint32 Value) {
+    if (Uses16BitIndices())
+      Indices16[Index] = static_cast<uint16>(Value);
+    else
+      Indices32[Index] = Value;
+  }
+
+  uint32 GetIndex(int32 Index) const {
+    return Uses16BitIndices() ? Indices16[Index] : Indices32[Index];
+  }
+
+  TArray<uint32> GetIndices() const {
+    TArray<uint32> Indices;
+    Indices.SetNumUninitialized(GetIndexCount());
+    for (int32 Index = 0; Index < Indices.Num(); Index++)
+      Indices[Index] = GetIndex(Index);
+    return Indices;
+  }
+
+  // Replaces the mesh after it was rebuilt; the new vertex count may change the index width
+  void Reset(TArray<FVector3f>&& NewVertices, const TArray<uint32>& NewIndices) {
+    Indices16.Empty();
+    Indices32.Empty();
+    Vertices = MoveTemp(NewVertices);
+    Init(Vertices.Num(), NewIndices.Num());
+    for (int32 Index = 0; Index < NewIndices.Num(); Index++)
+      SetIndex(Index, NewIndices[Index]);
+  }
+
+  const void* GetIndexData() const {
+    return Uses16BitIndices() ? static_cast<const void*>(Indices16.GetData()) : static_cast<const void*>(Indices32.GetData());
+  }
+  int32 GetIndexCount() const {
+    return Uses16BitIndices() ? Indices16.Num() : Indices32.Num();
+  }
+  ovrAudioScalarType GetIndexType() const {
+    return Uses16BitIndices() ? ovrAudioScalarType_UInt16 : ovrAudioScalarType_UInt32;
+  }
+};
+
+struct FMeshCleanupStats {
+  int32 WeldedVertices = 0;
+  int32 DegenerateFaces = 0;
+  int32 DuplicateFaces = 0;
+};
+
+// Merges vertices closer than Tolerance, keeping the first of each cluster. Cells are Tolerance wide so every candidate lies in
+// one of the 27 cells around a vertex; their coordinates are 64-bit so small tolerances don't overflow far from the origin.
+// Returns each original vertex's index in OutVertices.
+static TArray<uint32> WeldVertices(const TArray<FVector3f>& Vertices, const float Tolerance, TArray<FVector3f>& OutVertices) {
+  OutVertices.Reset(Vertices.Num());
+  TArray<uint32> Remap;
+  Remap.SetNumUninitialized(Vertices.Num());
+
+  // Without a tolerance only exact duplicates merge, which still lets repeated faces be found
+  if (Tolerance <= 0.0f) {
+    TMap<FVector3f, int32> Unique;
+    Unique.Reserve(Vertices.Num());
+    for (int32 Vertex = 0; Vertex < Vertices.Num(); Vertex++) {
+      const FVector3f& Position = Vertices[Vertex];
+      const int32* Existing = Unique.Find(Position);
+      Remap[Vertex] = Existing ? *Existing : Unique.Add(Position, OutVertices.Add(Position));
+    }
+    return Remap;
+  }
+
+  const double CellSize = Tolerance;
+  const float ToleranceSquared = Tolerance * Tolerance;
+  TMap<FInt64Vector, int32> CellHeads;
+  CellHeads.Reserve(Vertices.Num());
+  TArray<int32> NextInCell;
+  NextInCell.Reserve(Vertices.Num());
+
+  for (int32 Vertex = 0; Vertex < Vertices.Num(); Vertex++) {
+    const FVector3f& Position = Vertices[Vertex];
+    const FInt64Vector Cell(
+        FMath::FloorToInt64(Position.X / CellSize), FMath::FloorToInt64(Position.Y / CellSize), FMath::FloorToInt64(Position.Z / CellSize));
+
+    int32 Match = INDEX_NONE;
+    for (int32 Neighbor = 0; Neighbor < 27 && Match == INDEX_NONE; Neighbor++) {
+      const FInt64Vector NeighborCell = Cell + FInt64Vector(Neighbor % 3 - 1, (Neighbor / 3) % 3 - 1, Neighbor / 9 - 1);
+      const int32* Head = CellHeads.Find(NeighborCell);
+      for (int32 Candidate = Head ? *Head : INDEX_NONE; Candidate != INDEX_NONE; Candidate = NextInCell[Candidate]) {
+        if (FVector3f::DistSquared(OutVertices[Candidate], Position) <= ToleranceSquared) {
+          Match = Candidate;
+          break;
+        }
+      }
+    }
 
-  for (auto It = LandscapeInfo->XYtoComponentMap.CreateIterator(); It; ++It) {
-    ULandscapeComponent* Component = It.Value();
-    const int32 Length = Component->ComponentSizeQuads + 1;
-    TotalVertexCount += (Length * Length);
-    TotalIndexCount += 4 * (Length - 1) * (Length - 1);
+    if (Match == INDEX_NONE) {
+      Match = OutVertices.Add(Position);
+      int32& Head = CellHeads.FindOrAdd(Cell, INDEX_NONE);
+      NextInCell.Add(Head);
+      Head = Match;
+    }
+    Remap[Vertex] = Match;
   }
+  return Remap;
+}
 
-  TotalMaterialCount += 1;
+static bool IsDegenerateTriangle(const FVector3f& A, const FVector3f& B, const FVector3f& C) {
+  // Relative to the edge lengths so slivers are caught at any scale
+  const FVector3f AB = B - A;
+  const FVector3f AC = C - A;
+  return FVector3f::CrossProduct(AB, AC).SizeSquared() <= 1e-12f * AB.SizeSquared() * AC.SizeSquared();
 }
-#endif
 
-static bool UploadMeshFilter(
-    ovrAudioContext Context,
+// Welds the staged vertices and drops faces that collapse or exactly repeat an earlier face (e.g. the shared wall between two
+// modular pieces), so the simplifier starts from less. Mesh groups keep their order; only their face ranges shrink.
+static FMeshCleanupStats CleanMeshStaging(FMeshStagingArrays& Staging, TArray<ovrAudioMeshGroup>& MeshGroups, const float WeldTolerance) {
+  FMeshCleanupStats Stats;
+  TArray<FVector3f> Vertices;
+  const TArray<uint32> Remap = WeldVertices(Staging.Vertices, WeldTolerance, Vertices);
+  Stats.WeldedVertices = Staging.Vertices.Num() - Vertices.Num();
+
+  // Faces are keyed by their sorted vertex indices; W is unused for triangles
+  TSet<FIntVector4> Faces;
+  TArray<uint32> Indices;
+  Indices.Reserve(Staging.GetIndexCount());
+  for (ovrAudioMeshGroup& MeshGroup : MeshGroups) {
+    const int32 FaceSize = MeshGroup.faceType == ovrAudioFaceType_Quads ? 4 : 3;
+    const int32 FirstIndex = Indices.Num();
+    int32 FaceCount = 0;
+    for (int32 Face = 0; Face < static_cast<int32>(MeshGroup.faceCount); Face++) {
+      uint32 Corners[4] = {};
+      for (int32 Corner = 0; Corner < FaceSize; Corner++)
+        Corners[Corner] = Remap[Staging.GetIndex(MeshGroup.indexOffset + Face * FaceSize + Corner)];
+
+      const FVector3f& A = Vertices[Corners[0]];
+      const FVector3f& B = Vertices[Corners[1]];
+      const FVector3f& C = Vertices[Corners[2]];
+      const bool bDegenerate = FaceSize == 3 ? IsDegenerateTriangle(A, B, C)
+                                             : IsDegenerateTriangle(A, B, C) && IsDegenerateTriangle(A, C, Vertices[Corners[3]]);
+      if (bDegenerate) {
+        Stats.DegenerateFaces++;
+        continue;
+      }
+
+      uint32 Sorted[4] = {Corners[0], Corners[1], Corners[2], FaceSize == 4 ? Corners[3] : MAX_uint32};
+      Algo::Sort(Sorted);
+      bool bDuplicate = false;
+      Faces.Add(FIntVector4(Sorted[0], Sorted[1], Sorted[2], Sorted[3]), &bDuplicate);
+      if (bDuplicate) {
+        Stats.DuplicateFaces++;
+        continue;
+      }
+
+      Indices.Append(Corners, FaceSize);
+      FaceCount++;
+    }
+    MeshGroup.indexOffset = FirstIndex;
+    MeshGroup.faceCount = FaceCount;
+  }
+
+  Staging.Reset(MoveTemp(Vertices), Indices);
+  return Stats;
+}
+
+// Most voxels a reachability grid may hold; larger geometry is voxelized more coarsely
+static constexpr int64 MaxReachabilityVoxels = 256 * 256 * 256;
+
+// Separating axis test between a triangle and an axis-aligned cube (Akenine-Moller)
+static bool TriangleOverlapsCube(
+    const FVector3f& Center,
+    const float HalfSize,
+    const FVector3f& A,
+    const FVector3f& B,
+    const FVector3f& C) {
+  const FVector3f V[3] = {A - Center, B - Center, C - Center};
+  const FVector3f Edges[3] = {V[1] - V[0], V[2] - V[1], V[0] - V[2]};
+  const auto IsSeparating = [&V, HalfSize](const FVector3f& Axis) {
+    const float P0 = FVector3f::DotProduct(V[0], Axis);
+    const float P1 = FVector3f::DotProduct(V[1], Axis);
+    const float P2 = FVector3f::DotProduct(V[2], Axis);
+    const float Radius = HalfSize * (FMath::Abs(Axis.X) + FMath::Abs(Axis.Y) + FMath::Abs(Axis.Z));
+    return FMath::Min3(P0, P1, P2) > Radius || FMath::Max3(P0, P1, P2) < -Radius;
+  };
+
+  const FVector3f CubeAxes[3] = {FVector3f::XAxisVector, FVector3f::YAxisVector, FVector3f::ZAxisVector};
+  for (const FVector3f& CubeAxis : CubeAxes) {
+    if (IsSeparating(CubeAxis))
+      return false;
+    for (const FVector3f& Edge : Edges) {
+      if (IsSeparating(FVector3f::CrossProduct(Edge, CubeAxis)))
+        return false;
+    }
+  }
+  return !IsSeparating(FVector3f::CrossProduct(Edges[0], Edges[1]));
+}
+
+static const FIntVector VoxelNeighborOffsets[6] = {
+    FIntVector(1, 0, 0), FIntVector(-1, 0, 0), FIntVector(0, 1, 0), FIntVector(0, -1, 0), FIntVector(0, 0, 1), FIntVector(0, 0, -1)};
+
+// Voxel grid over the staged mesh. Voxels touched by a face are solid; the empty voxels connected to a seed are reachable.
+class FReachabilityGrid {
+ public:
+  enum EVoxel : uint8 { Empty, Solid, Reachable };
+
+  FReachabilityGrid(const FBox3f& Bounds, float InVoxelSize) : VoxelSize(InVoxelSize) {
+    // One empty voxel of padding on every side so the outside is connected all the way around
+    const FVector3f Size = Bounds.GetSize();
+    for (;;) {
+      Dims = FIntVector(
+          FMath::CeilToInt(Size.X / VoxelSize) + 2, FMath::CeilToInt(Size.Y / VoxelSize) + 2, FMath::CeilToInt(Size.Z / VoxelSize) + 2);
+      const int64 VoxelCount = static_cast<int64>(Dims.X) * Dims.Y * Dims.Z;
+      if (VoxelCount <= MaxReachabilityVoxels)
+        break;
+      VoxelSize *= FMath::Max(FMath::Pow(static_cast<float>(VoxelCount) / MaxReachabilityVoxels, 1.0f / 3.0f), 1.01f);
+    }
+    Origin = Bounds.Min - FVector3f(VoxelSize);
+    Voxels.SetNumZeroed(Dims.X * Dims.Y * Dims.Z);
+  }
+
+  float GetVoxelSize() const {
+    return VoxelSize;
+  }
+  const FVector3f& GetOrigin() const {
+    return Origin;
+  }
+  const FIntVector& GetDims() const {
+    return Dims;
+  }
+
+  void MarkSolid(const FVector3f& A, const FVector3f& B, const FVector3f& C) {
+    ForEachOverlappingVoxel(A, B, C, [this](int32 Index) { Voxels[Index] = Solid; });
+  }
+  // Also calls Functor with the index of every voxel the face touches
+  template <typename FunctorType>
+  void MarkSolid(const FVector3f& A, const FVector3f& B, const FVector3f& C, FunctorType&& Functor) {
+    ForEachOverlappingVoxel(A, B, C, [this, &Functor](int32 Index) {
+      Voxels[Index] = Solid;
+      Functor(Index);
+    });
+  }
+
+  // Breadth-first over empty voxels from the padding and from every seed inside the grid
+  void FloodFill(const TArray<FVector3f>& Seeds) {
+    TArray<int32> Queue;
+    const auto Visit = [this, &Queue](const FIntVector& Voxel) {
+      const int32 Index = GetIndex(Voxel);
+      if (Voxels[Index] != Empty)
+        return;
+      Voxels[Index] = Reachable;
+      Queue.Add(Index);
+    };
+
+    for (int32 Z = 0; Z < Dims.Z; Z++) {
+      for (int32 Y = 0; Y < Dims.Y; Y++) {
+        for (int32 X = 0; X < Dims.X; X++) {
+          if (X == 0 || Y == 0 || Z == 0 || X == Dims.X - 1 || Y == Dims.Y - 1 || Z == Dims.Z - 1)
+            Visit(FIntVector(X, Y, Z));
+        }
+      }
+    }
+    for (const FVector3f& Seed : Seeds) {
+      const FIntVector Voxel = GetVoxel(Seed);
+      if (Contains(Voxel))
+        Visit(Voxel);
+    }
+
+    for (int32 Head = 0; Head < Queue.Num(); Head++) {
+      const FIntVector Voxel = GetVoxel(Queue[Head]);
+      for (const FIntVector& Offset : VoxelNeighborOffsets) {
+        if (Contains(Voxel + Offset))
+          Visit(Voxel + Offset);
+      }
+    }
+  }
+
+  // A face can be hit if one of the voxels it touches borders reachable space
+  bool IsReachable(const FVector3f& A, const FVector3f& B, const FVector3f& C) const {
+    bool bReachable = false;
+    ForEachOverlappingVoxel(A, B, C, [this, &bReachable](int32 Index) {
+      const FIntVector Voxel = GetVoxel(Index);
+      for (const FIntVector& Offset : VoxelNeighborOffsets) {
+        if (Contains(Voxel + Offset) && Voxels[GetIndex(Voxel + Offset)] == Reachable)
+          bReachable = true;
+      }
+    });
+    return bReachable;
+  }
+
+  // Solid, or empty but sealed off from every seed
+  bool IsEnclosed(const FIntVector& Voxel) const {
+    return Voxels[GetIndex(Voxel)] != Reachable;
+  }
+
+  int32 GetIndex(const FIntVector& Voxel) const {
+    return Voxel.X + Dims.X * (Voxel.Y + Dims.Y * Voxel.Z);
+  }
+
+ private:
+  template <typename FunctorType>
+  void ForEachOverlappingVoxel(const FVector3f& A, const FVector3f& B, const FVector3f& C, FunctorType&& Functor) const {
+    const FIntVector Min = GetVoxel(A.ComponentMin(B).ComponentMin(C));
+    const FIntVector Max = GetVoxel(A.ComponentMax(B).ComponentMax(C));
+    const float HalfSize = 0.5f * VoxelSize;
+    for (int32 Z = FMath::Max(Min.Z, 0); Z <= FMath::Min(Max.Z, Dims.Z - 1); Z++) {
+      for (int32 Y = FMath::Max(Min.Y, 0); Y <= FMath::Min(Max.Y, Dims.Y - 1); Y++) {
+        for (int32 X = FMath::Max(Min.X, 0); X <= FMath::Min(Max.X, Dims.X - 1); X++) {
+          const FVector3f Center = Origin + (FVector3f(X, Y, Z) + FVector3f(0.5f)) * VoxelSize;
+          if (TriangleOverlapsCube(Center, HalfSize, A, B, C))
+            Functor(GetIndex(FIntVector(X, Y, Z)));
+        }
+      }
+    }
+  }
+
+  FIntVector GetVoxel(const FVector3f& Position) const {
+    const FVector3f Local = (Position - Origin) / VoxelSize;
+    return FIntVector(FMath::FloorToInt(Local.X), FMath::FloorToInt(Local.Y), FMath::FloorToInt(Local.Z));
+  }
+  FIntVector GetVoxel(int32 Index) const {
+    return FIntVector(Index % Dims.X, (Index / Dims.X) % Dims.Y, Index / (Dims.X * Dims.Y));
+  }
+  bool Contains(const FIntVector& Voxel) const {
+    return Voxel.X >= 0 && Voxel.Y >= 0 && Voxel.Z >= 0 && Voxel.X < Dims.X && Voxel.Y < Dims.Y && Voxel.Z < Dims.Z;
+  }
+
+  FVector3f Origin;
+  float VoxelSize;
+  FIntVector Dims;
+  TArray<uint8> Voxels;
+};
+
+// Calls Functor with each triangle of a staged face; quads are split along their first diagonal
+template <typename FunctorType>
+static void ForEachStagedTriangle(
+    const FMeshStagingArrays& Staging,
+    const ovrAudioMeshGroup& MeshGroup,
+    const int32 Face,
+    FunctorType&& Functor) {
+  const TArray<FVector3f>& Vertices = Staging.Vertices;
+  const int32 FaceSize = MeshGroup.faceType == ovrAudioFaceType_Quads ? 4 : 3;
+  const int32 First = MeshGroup.indexOffset + Face * FaceSize;
+  const FVector3f& A = Vertices[Staging.GetIndex(First)];
+  Functor(A, Vertices[Staging.GetIndex(First + 1)], Vertices[Staging.GetIndex(First + 2)]);
+  if (FaceSize == 4)
+    Functor(A, Vertices[Staging.GetIndex(First + 2)], Vertices[Staging.GetIndex(First + 3)]);
+}
+
+// Drops the faces no sound can reach: faces buried inside closed meshes, floor undersides resting on other floors, the backs of
+// walls against terrain. Reachable space is flood filled from outside the mesh and from Seeds (in staging space). Vertices are
+// left alone; the simplifier ignores the ones no face uses. Returns the number of culled faces.
+static int32 CullInteriorFaces(
+    FMeshStagingArrays& Staging,
     TArray<ovrAudioMeshGroup>& MeshGroups,
-    TArray<FVector>& Vertices,
-    TArray<uint32>& Indices,
-    int32& VertexOffset,
-    int32& IndexOffset,
-    int32& GroupOffset,
-    const UStaticMesh* Mesh,
-    const int32 LOD,
-    const TArray<UMetaXRAcousticMaterialProperties*>& Materials,
-    const FMatrix Matrix) {
-  // Lowest LOD
-  int32 LodGroupToUse = FMath::Clamp(LOD, 0, Mesh->GetRenderData()->LODResources.Num() - 1);
-  const FStaticMeshLODResources& Model = Mesh->GetRenderData()->LODResources[LodGroupToUse];
-  const FPositionVertexBuffer& VertexBuffer = Model.VertexBuffers.PositionVertexBuffer;
-  const int32 VertexCount = VertexBuffer.GetNumVertices();
+    const float VoxelSize,
+    const TArray<FVector3f>& Seeds) {
+  FReachabilityGrid Grid(FBox3f(Staging.Vertices), FMath::Max(VoxelSize, 1.0f));
+  for (const ovrAudioMeshGroup& MeshGroup : MeshGroups) {
+    for (int32 Face = 0; Face < static_cast<int32>(MeshGroup.faceCount); Face++) {
+      ForEachStagedTriangle(
+          Staging, MeshGroup, Face, [&Grid](const FVector3f& A, const FVector3f& B, const FVector3f& C) { Grid.MarkSolid(A, B, C); });
+    }
+  }
+  Grid.FloodFill(Seeds);
+
+  // Compact the surviving faces in place; the write position never passes the read position
+  int32 CulledFaces = 0;
+  int32 WriteIndex = 0;
+  for (ovrAudioMeshGroup& MeshGroup : MeshGroups) {
+    const int32 FaceSize = MeshGroup.faceType == ovrAudioFaceType_Quads ? 4 : 3;
+    const int32 FirstIndex = WriteIndex;
+    int32 FaceCount = 0;
+    for (int32 Face = 0; Face < static_cast<int32>(MeshGroup.faceCount); Face++) {
+      bool bReachable = false;
+      ForEachStagedTriangle(Staging, MeshGroup, Face, [&Grid, &bReachable](const FVector3f& A, const FVector3f& B, const FVector3f& C) {
+        bReachable = bReachable || Grid.IsReachable(A, B, C);
+      });
+      if (!bReachable) {
+        CulledFaces++;
+        continue;
+      }
 
-  // append this mesh's vertices to the merged array after coordinate system conversion
-  for (int32 Index = 0; Index < VertexCount; Index++) {
-    int32 Offset = (VertexOffset + Index);
-    FVector TransformedVertex = UKismetMathLibrary::Matrix_TransformPosition(Matrix, (FVector)VertexBuffer.VertexPosition(Index));
-    Vertices[Offset] = MetaXRAudioUtilities::ToOVRVector(TransformedVertex);
+      for (int32 Corner = 0; Corner < FaceSize; Corner++)
+        Staging.SetIndex(WriteIndex++, Staging.GetIndex(MeshGroup.indexOffset + Face * FaceSize + Corner));
+      FaceCount++;
+    }
+    MeshGroup.indexOffset = FirstIndex;
+    MeshGroup.faceCount = FaceCount;
   }
-  const int32 IndexCount = Model.IndexBuffer.GetNumIndices();
-  for (int32 Index = 0; Index < IndexCount; Index++) {
-    Indices[IndexOffset + Index] = Model.IndexBuffer.GetIndex(Index) + VertexOffset;
+
+  if (Staging.Uses16BitIndices())
+    Staging.Indices16.SetNum(WriteIndex);
+  else
+    Staging.Indices32.SetNum(WriteIndex);
+  return CulledFaces;
+}
+
+// Replaces the staged faces with the boundary of the space they enclose: faces are voxelized, the space reachable from outside and
+// from Seeds is flood filled, and everything else is wrapped in a watertight surface nets shell with one vertex per boundary cell. Each
+// shell face takes the mesh group that covers the most area in its solid voxel, so mesh groups keep their order and materials.
+// Returns the number of shell triangles.
+static int32 RemeshVoxelShell(
+    FMeshStagingArrays& Staging,
+    TArray<ovrAudioMeshGroup>& MeshGroups,
+    const float VoxelSize,
+    const TArray<FVector3f>& Seeds) {
+  FReachabilityGrid Grid(FBox3f(Staging.Vertices), FMath::Max(VoxelSize, 1.0f));
+  const int32 GroupCount = MeshGroups.Num();
+  // Face area per voxel and mesh group, keyed by voxel index * group count + group
+  TMap<int64, float> GroupAreas;
+  for (int32 Group = 0; Group < GroupCount; Group++) {
+    const ovrAudioMeshGroup& MeshGroup = MeshGroups[Group];
+    const auto MarkTriangle = [&Grid, &GroupAreas, GroupCount, Group](const FVector3f& A, const FVector3f& B, const FVector3f& C) {
+      // Never zero, so a voxel touched only by slivers still has a group
+      const float Area = 0.5f * FVector3f::CrossProduct(B - A, C - A).Size() + UE_KINDA_SMALL_NUMBER;
+      Grid.MarkSolid(A, B, C, [&GroupAreas, GroupCount, Group, Area](int32 Index) {
+        GroupAreas.FindOrAdd(static_cast<int64>(Index) * GroupCount + Group) += Area;
+      });
+    };
+    for (int32 Face = 0; Face < static_cast<int32>(MeshGroup.faceCount); Face++)
+      ForEachStagedTriangle(Staging, MeshGroup, Face, MarkTriangle);
+  }
+  Grid.FloodFill(Seeds);
+
+  TMap<int32, TPair<int32, float>> VoxelGroups;
+  for (const TPair<int64, float>& GroupArea : GroupAreas) {
+    TPair<int32, float>& Dominant = VoxelGroups.FindOrAdd(static_cast<int32>(GroupArea.Key / GroupCount), {INDEX_NONE, 0.0f});
+    if (GroupArea.Value > Dominant.Value)
+      Dominant = {static_cast<int32>(GroupArea.Key % GroupCount), GroupArea.Value};
+  }
+
+  // Cells are the cubes between eight voxel centers; a cell whose corners are neither all enclosed nor all open gets a vertex at
+  // the average of its crossing edges' midpoints. The grid's padding is always open, even where a face grazes it, which keeps
+  // every boundary cell inside the grid.
+  const FIntVector& Dims = Grid.GetDims();
+  const auto IsEnclosed = [&Grid, &Dims](const FIntVector& Voxel) {
+    return Voxel.X > 0 && Voxel.Y > 0 && Voxel.Z > 0 && Voxel.X < Dims.X - 1 && Voxel.Y < Dims.Y - 1 && Voxel.Z < Dims.Z - 1 &&
+        Grid.IsEnclosed(Voxel);
+  };
+  const float CellSize = Grid.GetVoxelSize();
+  const FVector3f CellOrigin = Grid.GetOrigin() + FVector3f(0.5f * CellSize);
+  const auto GetCellIndex = [&Dims](const FIntVector& Cell) { return Cell.X + Dims.X * (Cell.Y + Dims.Y * Cell.Z); };
+  TMap<int32, uint32> CellVertices;
+  TArray<FVector3f> Vertices;
+  for (int32 Z = 0; Z < Dims.Z - 1; Z++) {
+    for (int32 Y = 0; Y < Dims.Y - 1; Y++) {
+      for (int32 X = 0; X < Dims.X - 1; X++) {
+        bool Corners[8];
+        int32 EnclosedCorners = 0;
+        for (int32 Corner = 0; Corner < 8; Corner++) {
+          Corners[Corner] = IsEnclosed(FIntVector(X + (Corner & 1), Y + ((Corner >> 1) & 1), Z + (Corner >> 2)));
+          EnclosedCorners += Corners[Corner] ? 1 : 0;
+        }
+        if (EnclosedCorners == 0 || EnclosedCorners == 8)
+          continue;
+
+        FVector3f Sum = FVector3f::ZeroVector;
+        int32 Crossings = 0;
+        for (int32 Corner = 0; Corner < 8; Corner++) {
+          for (int32 Axis = 0; Axis < 3; Axis++) {
+            const int32 Other = Corner | (1 << Axis);
+            if (Other == Corner || Corners[Corner] == Corners[Other])
+              continue;
+            const FVector3f A(Corner & 1, (Corner >> 1) & 1, Corner >> 2);
+            const FVector3f B(Other & 1, (Other >> 1) & 1, Other >> 2);
+            Sum += 0.5f * (A + B);
+            Crossings++;
+          }
+        }
+        CellVertices.Add(GetCellIndex(FIntVector(X, Y, Z)), Vertices.Add(CellOrigin + (FVector3f(X, Y, Z) + Sum / Crossings) * CellSize));
+      }
+    }
+  }
+
+  // Every edge between an enclosed and an open voxel center is crossed by the quad joining the four cells around it, wound to face
+  // the open side
+  TArray<TArray<uint32>> GroupIndices;
+  GroupIndices.SetNum(GroupCount);
+  for (int32 Z = 0; Z < Dims.Z; Z++) {
+    for (int32 Y = 0; Y < Dims.Y; Y++) {
+      for (int32 X = 0; X < Dims.X; X++) {
+        const FIntVector Voxel(X, Y, Z);
+        const bool bEnclosed = IsEnclosed(Voxel);
+        for (int32 Axis = 0; Axis < 3; Axis++) {
+          FIntVector Next = Voxel;
+          Next[Axis]++;
+          if (Next[Axis] >= Dims[Axis] || bEnclosed == IsEnclosed(Next))
+            continue;
+
+          const int32 U = (Axis + 1) % 3;
+          const int32 V = (Axis + 2) % 3;
+          uint32 Quad[4];
+          for (int32 Corner = 0; Corner < 4; Corner++) {
+            FIntVector Cell = Voxel;
+            Cell[U] -= (Corner == 0 || Corner == 3) ? 1 : 0;
+            Cell[V] -= Corner < 2 ? 1 : 0;
+            Quad[Corner] = CellVertices[GetCellIndex(Cell)];
+          }
+          if (!bEnclosed)
+            Swap(Quad[1], Quad[3]);
+
+          const TPair<int32, float>* Dominant = VoxelGroups.Find(Grid.GetIndex(bEnclosed ? Voxel : Next));
+          TArray<uint32>& Indices = GroupIndices[Dominant ? Dominant->Key : 0];
+          Indices.Append({Quad[0], Quad[1], Quad[2], Quad[0], Quad[2], Quad[3]});
+        }
+      }
+    }
+  }
+
+  TArray<uint32> Indices;
+  for (int32 Group = 0; Group < GroupCount; Group++) {
+    MeshGroups[Group].faceType = ovrAudioFaceType_Triangles;
+    MeshGroups[Group].indexOffset = Indices.Num();
+    MeshGroups[Group].faceCount = GroupIndices[Group].Num() / 3;
+    Indices.Append(GroupIndices[Group]);
   }
 
+  Staging.Reset(MoveTemp(Vertices), Indices);
+  return Indices.Num() / 3;
+}
+
+// Lays the staged faces and vertices out along a Morton curve, which also drops the vertices culling or welding left unused
+static void SortMeshStaging(FMeshStagingArrays& Staging, TArray<ovrAudioMeshGroup>& MeshGroups) {
+  TArray<FVector3f> Vertices = MoveTemp(Staging.Vertices);
+  TArray<uint32> Indices = Staging.GetIndices();
+  MetaXRAcousticMeshLayout::SortMorton(Vertices, Indices, MeshGroups);
+  Staging.Reset(MoveTemp(Vertices), Indices);
+}
+
+template <typename IndexType>
+static void CopyMeshIndices(const FMeshTransformJob& Job, IndexType* IndexDest) {
+  const FRawStaticIndexBuffer& IndexBuffer = Job.Model->IndexBuffer;
+  for (int32 Index = Job.FirstIndex; Index < Job.FirstIndex + Job.NumIndices; Index++)
+    IndexDest[Index] = static_cast<IndexType>(IndexBuffer.GetIndex(Index) + Job.VertexOffset);
+}
+
+static void RunMeshTransformJob(const FMeshTransformJob& Job, FMeshStagingArrays& Staging) {
+  const FPositionVertexBuffer& VertexBuffer = Job.Model->VertexBuffers.PositionVertexBuffer;
+  FVector3f* const VertexDest = Staging.Vertices.GetData() + Job.VertexOffset;
+  for (int32 Index = Job.FirstVertex; Index < Job.FirstVertex + Job.NumVertices; Index++)
+    VertexDest[Index] = FVector3f(Job.Matrix.TransformPosition(FVector(VertexBuffer.VertexPosition(Index))));
+
+  // Pick the index width once per job rather than per index
+  if (Staging.Uses16BitIndices())
+    CopyMeshIndices(Job, Staging.Indices16.GetData() + Job.IndexOffset);
+  else
+    CopyMeshIndices(Job, Staging.Indices32.GetData() + Job.IndexOffset);
+}
+
+// Fill one mesh group per section of Model, starting at GroupOffset, with the section's material
+static bool CreateSectionMeshGroups(
+    FMetaXRAcousticMaterialRefs& MaterialRefs,
+    TArray<ovrAudioMeshGroup>& MeshGroups,
+    const int32 GroupOffset,
+    const int32 IndexOffset,
+    const FStaticMeshLODResources& Model,
+    const TArray<UMetaXRAcousticMaterialProperties*>& Materials) {
   // loop over each section in lowest LOD
   for (int32 Index = 0; Index < Model.Sections.Num(); Index++) {
     ovrAudioMeshGroup& MeshGroup = MeshGroups[GroupOffset + Index];
@@ -474,22 +1125,55 @@ static bool UploadMeshFilter(
 
     ovrAudioMaterial OvrMaterial = nullptr;
     if (!Materials.IsEmpty()) {
-      ovrResult Result = OVRA_CALL(ovrAudio_CreateAudioMaterial)(Context, &OvrMaterial);
-      if (Result != ovrSuccess) {
-        return false;
-      }
-
       int MatIndex = Index;
       if (MatIndex >= Materials.Num())
         MatIndex = Materials.Num() - 1;
 
-      if (Materials[MatIndex]) {
-        Materials[MatIndex]->ConstructMaterial(OvrMaterial);
-      }
+      if (!MaterialRefs.Find(Materials[MatIndex], OvrMaterial))
+        return false;
     }
     MeshGroup.material = OvrMaterial;
   }
 
+  return true;
+}
+
+static bool UploadMeshFilter(
+    FMetaXRAcousticMaterialRefs& MaterialRefs,
+    TArray<ovrAudioMeshGroup>& MeshGroups,
+    TArray<FMeshTransformJob>& Jobs,
+    int32& VertexOffset,
+    int32& IndexOffset,
+    int32& GroupOffset,
+    const UStaticMesh* Mesh,
+    const int32 LOD,
+    const TArray<UMetaXRAcousticMaterialProperties*>& Materials,
+    const FMatrix Matrix) {
+  // Lowest LOD
+  int32 LodGroupToUse = FMath::Clamp(LOD, 0, Mesh->GetRenderData()->LODResources.Num() - 1);
+  const FStaticMeshLODResources& Model = Mesh->GetRenderData()->LODResources[LodGroupToUse];
+  const FPositionVertexBuffer& VertexBuffer = Model.VertexBuffers.PositionVertexBuffer;
+  const int32 VertexCount = VertexBuffer.GetNumVertices();
+  const int32 IndexCount = Model.IndexBuffer.GetNumIndices();
+
+  // queue this mesh's vertices and indices for the merged arrays; coordinate conversion happens in the parallel pass
+  const FMatrix OVRMatrix = MetaXRAudioUtilities::ToOVRMatrix(Matrix);
+  const int32 SliceCount = FMath::Max(1, FMath::DivideAndRoundUp(FMath::Max(VertexCount, IndexCount), MeshTransformJobSize));
+  for (int32 Slice = 0; Slice < SliceCount; Slice++) {
+    FMeshTransformJob& Job = Jobs.AddDefaulted_GetRef();
+    Job.Model = &Model;
+    Job.Matrix = OVRMatrix;
+    Job.VertexOffset = VertexOffset;
+    Job.IndexOffset = IndexOffset;
+    Job.FirstVertex = FMath::Min(Slice * MeshTransformJobSize, VertexCount);
+    Job.NumVertices = FMath::Min(MeshTransformJobSize, VertexCount - Job.FirstVertex);
+    Job.FirstIndex = FMath::Min(Slice * MeshTransformJobSize, IndexCount);
+    Job.NumIndices = FMath::Min(MeshTransformJobSize, IndexCount - Job.FirstIndex);
+  }
+
+  if (!CreateSectionMeshGroups(MaterialRefs, MeshGroups, GroupOffset, IndexOffset, Model, Materials))
+    return false;
+
   // Update the offsets for the next meshs
   VertexOffset += VertexCount;
   IndexOffset += IndexCount;
@@ -500,10 +1184,9 @@ static bool UploadMeshFilter(
 
 // Duplicate the mesh information for each Instanced Static Mesh
 static bool UploadInstancedMeshFilter(
-    ovrAudioContext Context,
+    FMetaXRAcousticMaterialRefs& MaterialRefs,
     TArray<ovrAudioMeshGroup>& MeshGroups,
-    TArray<FVector>& Vertices,
-    TArray<uint32>& Indices,
+    TArray<FMeshTransformJob>& Jobs,
     int32& VertexOffset,
     int32& IndexOffset,
     int32& GroupOffset,
@@ -519,10 +1202,9 @@ static bool UploadInstancedMeshFilter(
       return false;
 
     uploadSuccessful = UploadMeshFilter(
-        Context,
+        MaterialRefs,
         MeshGroups,
-        Vertices,
-        Indices,
+        Jobs,
         VertexOffset,
         IndexOffset,
         GroupOffset,
@@ -540,10 +1222,9 @@ static bool UploadInstancedMeshFilter(
 
 // Handles the geometry upload and accounts for instanced static meshes...
 static bool HandleNextMeshFilterUpload(
-    ovrAudioContext Context,
+    FMetaXRAcousticMaterialRefs& MaterialRefs,
     TArray<ovrAudioMeshGroup>& MeshGroups,
-    TArray<FVector>& Vertices,
-    TArray<uint32>& Indices,
+    TArray<FMeshTransformJob>& Jobs,
     int32& VertexOffset,
     int32& IndexOffset,
     int32& GroupOffset,
@@ -551,7 +1232,7 @@ static bool HandleNextMeshFilterUpload(
     const FMatrix& AcousticGeoCompWM) {
   if (AcousticMesh.IsInstanced()) {
     return UploadInstancedMeshFilter(
-        Context, MeshGroups, Vertices, Indices, VertexOffset, IndexOffset, GroupOffset, AcousticMesh, AcousticGeoCompWM);
+        MaterialRefs, MeshGroups, Jobs, VertexOffset, IndexOffset, GroupOffset, AcousticMesh, AcousticGeoCompWM);
   }
 
   const UStaticMeshComponent* StaticMeshCompPtr = AcousticMesh.StaticMesh;
@@ -560,10 +1241,9 @@ static bool HandleNextMeshFilterUpload(
   const FMatrix AcousticMeshLocalMatrix =
       UKismetMathLibrary::Multiply_MatrixMatrix(AcousticMeshWorldMatrix, UKismetMathLibrary::Matrix_GetInverse(AcousticGeoCompWM));
   return UploadMeshFilter(
-      Context,
+      MaterialRefs,
       MeshGroups,
-      Vertices,
-      Indices,
+      Jobs,
       VertexOffset,
       IndexOffset,
       GroupOffset,
@@ -573,141 +1253,1835 @@ static bool HandleNextMeshFilterUpload(
       AcousticMeshLocalMatrix);
 }
 
-#if WITH_EDITOR
-static bool UploadLandscapeFilter(
-    ovrAudioContext Context,
-    TArray<ovrAudioMeshGroup>& MeshGroups,
-    TArray<FVector>& Vertices,
-    TArray<uint32>& Indices,
-    int32& VertexOffset,
-    int32& IndexOffset,
-    int32& GroupOffset,
-    UMetaXRAcousticGeometry::FLandscapeMaterial Landscape,
-    FMatrix WorldToLocal) {
-  int32 FirstIndex = IndexOffset;
-  int32 FaceCount = 0;
-  for (auto It = Landscape.LandscapeInfo->XYtoComponentMap.CreateIterator(); It; ++It) {
-    ULandscapeComponent* Component = It.Value();
-
-    // Compute the combined transform to go from mesh-local to geometry-local space.
-    FMatrix localMatrix = UKismetMathLibrary::Conv_TransformToMatrix(Component->GetComponentTransform());
-    FMatrix Matrix = UKismetMathLibrary::Multiply_MatrixMatrix(localMatrix, UKismetMathLibrary::Matrix_GetInverse(WorldToLocal));
-
-    FLandscapeComponentDataInterface DataInterface(Component);
-    const int Offset = VertexOffset;
-    const int Length = Component->ComponentSizeQuads + 1;
-
-    for (auto y = 0; y < Length; ++y) {
-      for (auto x = 0; x < Length; ++x) {
-        FVector vertex = DataInterface.GetLocalVertex(x, y);
-        Vertices[VertexOffset++] = MetaXRAudioUtilities::ToOVRVector(UKismetMathLibrary::Matrix_TransformPosition(Matrix, vertex));
-
-        // there are only (N-1)^2 quads for N^2 verts
-        if (x == (Length - 1) || y == (Length - 1))
-          continue;
+static bool HasSimpleCollision(const UStaticMesh* Mesh) {
+  const UBodySetup* BodySetup = Mesh ? Mesh->GetBodySetup() : nullptr;
+  if (!BodySetup)
+    return false;
 
-        auto calcIndex = [](int x, int y, int length) { return (y * length) + x; };
-        Indices[IndexOffset + 0] = Offset + calcIndex(x, y, Length);
-        Indices[IndexOffset + 1] = Offset + calcIndex(x, y + 1, Length);
-        Indices[IndexOffset + 2] = Offset + calcIndex(x + 1, y + 1, Length);
-        Indices[IndexOffset + 3] = Offset + calcIndex(x + 1, y, Length);
+  const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+  return AggGeom.BoxElems.Num() + AggGeom.SphereElems.Num() + AggGeom.SphylElems.Num() + AggGeom.ConvexElems.Num() > 0;
+}
+
+static EMeshUploadPath GetMeshUploadPath(const AcousticMesh& Mesh, const FMeshUploadOptions& Options) {
+  if (Options.InstanceProxy != EMetaXRAcousticInstanceProxy::None && Cast<UHierarchicalInstancedStaticMeshComponent>(Mesh.StaticMesh))
+    return EMeshUploadPath::Proxy;
+  if (Options.bSimplifyInstancesOnce && Mesh.IsInstanced())
+    return EMeshUploadPath::Prototype;
+  if (Options.bUseSimpleCollision && HasSimpleCollision(Mesh.StaticMesh->GetStaticMesh()))
+    return EMeshUploadPath::Collision;
+  return EMeshUploadPath::Merged;
+}
+
+// Corner i of a box sits at -1/+1 on X, Y and Z according to bits 0, 1 and 2. Each run of four is one face, wound consistently
+// outwards.
+static constexpr int32 BoxQuadCorners[24] = {0, 4, 6, 2, 1, 3, 7, 5, 0, 1, 5, 4, 2, 6, 7, 3, 0, 2, 3, 1, 4, 5, 7, 6};
+
+static FVector GetUnitBoxCorner(const int32 Corner) {
+  return FVector((Corner & 1) ? 1.0 : -1.0, (Corner & 2) ? 1.0 : -1.0, (Corner & 4) ? 1.0 : -1.0);
+}
+
+// A triangle mesh built from a static mesh's simple collision, in the static mesh's local space
+struct FCollisionMesh {
+  TArray<FVector3f> Vertices;
+  TArray<uint32> Indices;
+};
 
-        IndexOffset += 4;
-        ++FaceCount;
+static void AppendCollisionBox(FCollisionMesh& Out, const FKBoxElem& Elem) {
+  const FTransform Transform = Elem.GetTransform();
+  const FVector HalfExtent(Elem.X * 0.5f, Elem.Y * 0.5f, Elem.Z * 0.5f);
+  const uint32 First = Out.Vertices.Num();
+  for (int32 Corner = 0; Corner < 8; Corner++)
+    Out.Vertices.Add(FVector3f(Transform.TransformPosition(GetUnitBoxCorner(Corner) * HalfExtent)));
+
+  for (int32 Quad = 0; Quad < UE_ARRAY_COUNT(BoxQuadCorners); Quad += 4) {
+    const uint32 A = First + BoxQuadCorners[Quad], B = First + BoxQuadCorners[Quad + 1];
+    const uint32 C = First + BoxQuadCorners[Quad + 2], D = First + BoxQuadCorners[Quad + 3];
+    Out.Indices.Append({A, B, C, A, C, D});
+  }
+}
+
+// Coarse latitude/longitude tessellation along local Z. The upper half is raised and the lower half lowered by HalfLength, which
+// turns the sphere into a capsule.
+static void AppendCollisionCapsule(FCollisionMesh& Out, const FTransform& Transform, const float Radius, const float HalfLength) {
+  constexpr int32 Slices = 8;
+  constexpr int32 HalfStacks = 2;
+
+  const uint32 TopPole = Out.Vertices.Num();
+  Out.Vertices.Add(FVector3f(Transform.TransformPosition(FVector(0.0, 0.0, Radius + HalfLength))));
+
+  // A capsule's equator ring appears twice, once per half; a sphere's only once
+  TArray<uint32> Rings;
+  for (int32 Stack = 1; Stack < 2 * HalfStacks; Stack++) {
+    const bool bUpper = Stack <= HalfStacks;
+    const int32 Repeats = (Stack == HalfStacks && HalfLength > 0.0f) ? 2 : 1;
+    for (int32 Repeat = 0; Repeat < Repeats; Repeat++) {
+      const double Offset = (bUpper && Repeat == 0) ? HalfLength : -HalfLength;
+      const double Polar = UE_PI * Stack / (2 * HalfStacks);
+      Rings.Add(Out.Vertices.Num());
+      for (int32 Slice = 0; Slice < Slices; Slice++) {
+        const double Azimuth = 2.0 * UE_PI * Slice / Slices;
+        const FVector Position(
+            Radius * FMath::Sin(Polar) * FMath::Cos(Azimuth), Radius * FMath::Sin(Polar) * FMath::Sin(Azimuth), Radius * FMath::Cos(Polar));
+        Out.Vertices.Add(FVector3f(Transform.TransformPosition(Position + FVector(0.0, 0.0, Offset))));
       }
     }
   }
 
-  ovrAudioMaterial OvrMaterial = nullptr;
-  if (!Landscape.Materials.IsEmpty()) {
-    ovrResult Result = OVRA_CALL(ovrAudio_CreateAudioMaterial)(Context, &OvrMaterial);
-    if (Result != ovrSuccess) {
-      METAXR_AUDIO_LOG_WARNING("Unabled to create audio material for landscape!");
-      return false;
+  const uint32 BottomPole = Out.Vertices.Num();
+  Out.Vertices.Add(FVector3f(Transform.TransformPosition(FVector(0.0, 0.0, -Radius - HalfLength))));
+
+  for (int32 Slice = 0; Slice < Slices; Slice++) {
+    const uint32 Next = (Slice + 1) % Slices;
+    Out.Indices.Append({TopPole, Rings[0] + Next, Rings[0] + Slice});
+    for (int32 Ring = 0; Ring + 1 < Rings.Num(); Ring++) {
+      const uint32 Upper = Rings[Ring], Lower = Rings[Ring + 1];
+      Out.Indices.Append({Upper + Slice, Upper + Next, Lower + Next, Upper + Slice, Lower + Next, Lower + Slice});
     }
-    Landscape.Materials[0]->ConstructMaterial(OvrMaterial);
+    Out.Indices.Append({BottomPole, Rings.Last() + Slice, Rings.Last() + Next});
+  }
+}
+
+static void AppendCollisionConvex(FCollisionMesh& Out, const FKConvexElem& Elem) {
+  // Cooked convex elements may only carry their hull; rebuild the triangle indices from it on a copy
+  FKConvexElem Convex = Elem;
+  if (Convex.IndexData.IsEmpty())
+    Convex.ComputeChaosConvexIndices();
+  if (Convex.IndexData.IsEmpty() || Convex.VertexData.IsEmpty())
+    return;
+
+  const FTransform Transform = Convex.GetTransform();
+  const uint32 First = Out.Vertices.Num();
+  for (const FVector& Vertex : Convex.VertexData)
+    Out.Vertices.Add(FVector3f(Transform.TransformPosition(Vertex)));
+  for (const int32 Index : Convex.IndexData)
+    Out.Indices.Add(First + Index);
+}
+
+// Tessellates the boxes, spheres, capsules and convex hulls of a mesh's simple collision. Returns false when there are none.
+static bool BuildCollisionMesh(const UStaticMesh* Mesh, FCollisionMesh& OutMesh) {
+  if (!HasSimpleCollision(Mesh))
+    return false;
+
+  const FKAggregateGeom& AggGeom = Mesh->GetBodySetup()->AggGeom;
+  for (const FKBoxElem& Box : AggGeom.BoxElems)
+    AppendCollisionBox(OutMesh, Box);
+  for (const FKSphereElem& Sphere : AggGeom.SphereElems)
+    AppendCollisionCapsule(OutMesh, Sphere.GetTransform(), Sphere.Radius, 0.0f);
+  for (const FKSphylElem& Capsule : AggGeom.SphylElems)
+    AppendCollisionCapsule(OutMesh, Capsule.GetTransform(), Capsule.Radius, Capsule.Length * 0.5f);
+  for (const FKConvexElem& Convex : AggGeom.ConvexElems)
+    AppendCollisionConvex(OutMesh, Convex);
+
+  return !OutMesh.Indices.IsEmpty();
+}
+
+// Each mesh's placements relative to UMetaXRAcousticGeometry: one for a plain mesh, one per instance for an instanced mesh
+static bool GetAcousticMeshLocalMatrices(const AcousticMesh& Mesh, const FMatrix& AcousticGeoCompWM, TArray<FMatrix>& OutMatrices) {
+  const bool bInstanced = Mesh.IsInstanced();
+  const int32 Count = bInstanced ? Mesh.GetInstancedCount() : 1;
+  OutMatrices.SetNum(Count);
+  for (int32 Index = 0; Index < Count; Index++) {
+    if (!Mesh.GetAcousticMeshLocalMatrix(AcousticGeoCompWM, bInstanced ? Index : -1, OutMatrices[Index]))
+      return false;
+  }
+  return true;
+}
+
+// Appends every placement of one collision mesh as a single triangle mesh group
+static bool UploadCollisionMeshFilter(
+    FMetaXRAcousticMaterialRefs& MaterialRefs,
+    TArray<ovrAudioMeshGroup>& MeshGroups,
+    FMeshStagingArrays& Staging,
+    int32& VertexOffset,
+    int32& IndexOffset,
+    int32& GroupOffset,
+    const FCollisionMesh& CollisionMesh,
+    const TArray<UMetaXRAcousticMaterialProperties*>& Materials,
+    const TArray<FMatrix>& Matrices) {
+  const int32 FirstIndex = IndexOffset;
+  for (const FMatrix& Matrix : Matrices) {
+    const FMatrix OVRMatrix = MetaXRAudioUtilities::ToOVRMatrix(Matrix);
+    for (int32 Vertex = 0; Vertex < CollisionMesh.Vertices.Num(); Vertex++)
+      Staging.Vertices[VertexOffset + Vertex] = FVector3f(OVRMatrix.TransformPosition(FVector(CollisionMesh.Vertices[Vertex])));
+    for (int32 Index = 0; Index < CollisionMesh.Indices.Num(); Index++)
+      Staging.SetIndex(IndexOffset + Index, VertexOffset + CollisionMesh.Indices[Index]);
+
+    VertexOffset += CollisionMesh.Vertices.Num();
+    IndexOffset += CollisionMesh.Indices.Num();
+  }
+
+  // Collision has no sections, so the first acoustic material covers all of it
+  ovrAudioMaterial OvrMaterial = nullptr;
+  if (!Materials.IsEmpty() && !MaterialRefs.Find(Materials[0], OvrMaterial))
+    return false;
+
+  ovrAudioMeshGroup& MeshGroup = MeshGroups[GroupOffset++];
+  MeshGroup.faceCount = Matrices.Num() * CollisionMesh.Indices.Num() / 3;
+  MeshGroup.faceType = ovrAudioFaceType_Triangles;
+  MeshGroup.material = OvrMaterial;
+  MeshGroup.indexOffset = FirstIndex;
+
+  return true;
+}
+
+// Each proxy box is the matrix taking the unit cube [-1, 1]^3 to geometry-local space
+static bool BuildInstanceProxyBoxes(
+    const AcousticMesh& Mesh,
+    const FMatrix& AcousticGeoCompWM,
+    const EMetaXRAcousticInstanceProxy InstanceProxy,
+    const float ClusterSize,
+    TArray<FMatrix>& OutBoxes) {
+  const UStaticMesh* StaticMesh = Mesh.StaticMesh->GetStaticMesh();
+  const FBox MeshBox = StaticMesh->GetBoundingBox();
+  const FMatrix MeshBoxMatrix = FScaleMatrix(MeshBox.GetExtent()) * FTranslationMatrix(MeshBox.GetCenter());
+  const int32 InstanceCount = Mesh.GetInstancedCount();
+
+  // Cells are keyed by integer grid coordinates; TMap keeps insertion order so bakes stay deterministic
+  TMap<FIntVector, FBox> Clusters;
+  const double CellSize = FMath::Max(ClusterSize, 1.0f);
+  OutBoxes.Reserve(InstanceProxy == EMetaXRAcousticInstanceProxy::InstanceBox ? InstanceCount : 0);
+  for (int32 InstanceID = 0; InstanceID < InstanceCount; InstanceID++) {
+    FMatrix LocalMatrix;
+    if (!Mesh.GetAcousticMeshLocalMatrix(AcousticGeoCompWM, InstanceID, LocalMatrix))
+      return false;
+
+    if (InstanceProxy == EMetaXRAcousticInstanceProxy::InstanceBox) {
+      OutBoxes.Add(MeshBoxMatrix * LocalMatrix);
+      continue;
+    }
+
+    const FBox InstanceBox = MeshBox.TransformBy(LocalMatrix);
+    const FVector Cell = InstanceBox.GetCenter() / CellSize;
+    const FIntVector Key(FMath::FloorToInt32(Cell.X), FMath::FloorToInt32(Cell.Y), FMath::FloorToInt32(Cell.Z));
+    Clusters.FindOrAdd(Key, FBox(ForceInit)) += InstanceBox;
+  }
+
+  for (const TPair<FIntVector, FBox>& Cluster : Clusters)
+    OutBoxes.Add(FScaleMatrix(Cluster.Value.GetExtent()) * FTranslationMatrix(Cluster.Value.GetCenter()));
+
+  return true;
+}
+
+static constexpr int32 ProxyBoxVertexCount = 8;
+static constexpr int32 ProxyBoxIndexCount = UE_ARRAY_COUNT(BoxQuadCorners);
+
+// Appends the proxy boxes of one instanced mesh as a single quad mesh group
+static bool UploadInstanceProxyFilter(
+    FMetaXRAcousticMaterialRefs& MaterialRefs,
+    TArray<ovrAudioMeshGroup>& MeshGroups,
+    FMeshStagingArrays& Staging,
+    int32& VertexOffset,
+    int32& IndexOffset,
+    int32& GroupOffset,
+    const TArray<FMatrix>& Boxes,
+    const UMetaXRAcousticMaterialProperties* Material) {
+  const int32 FirstIndex = IndexOffset;
+  for (const FMatrix& Box : Boxes) {
+    const FMatrix OVRMatrix = MetaXRAudioUtilities::ToOVRMatrix(Box);
+    for (int32 Corner = 0; Corner < ProxyBoxVertexCount; Corner++)
+      Staging.Vertices[VertexOffset + Corner] = FVector3f(OVRMatrix.TransformPosition(GetUnitBoxCorner(Corner)));
+    for (int32 Index = 0; Index < ProxyBoxIndexCount; Index++)
+      Staging.SetIndex(IndexOffset + Index, VertexOffset + BoxQuadCorners[Index]);
+
+    VertexOffset += ProxyBoxVertexCount;
+    IndexOffset += ProxyBoxIndexCount;
+  }
+
+  ovrAudioMaterial OvrMaterial = nullptr;
+  if (!MaterialRefs.Find(Material, OvrMaterial)) {
+    METAXR_AUDIO_LOG_WARNING("Unable to create audio material for instance proxies!");
+    return false;
   }
 
   ovrAudioMeshGroup& MeshGroup = MeshGroups[GroupOffset++];
-  MeshGroup.faceCount = FaceCount;
+  MeshGroup.faceCount = Boxes.Num() * 6;
   MeshGroup.faceType = ovrAudioFaceType_Quads;
   MeshGroup.material = OvrMaterial;
   MeshGroup.indexOffset = FirstIndex;
 
   return true;
 }
+
+// A lone, non-instanced mesh that sits exactly on the geometry component needs no merging or transforming: the SDK can read its
+// positions and indices straight from the render data's CPU copies, with the axis swap moved into the geometry transform.
+// Returns nullptr when the meshes have to go through the merged staging arrays instead.
+static const FStaticMeshLODResources* FindMeshSpaceModel(
+    const TArray<const AcousticMesh*>& Meshes,
+    const bool bHasOtherGeometry,
+    const FTransform& Transform) {
+  if (Meshes.Num() != 1 || bHasOtherGeometry)
+    return nullptr;
+
+  const AcousticMesh& Mesh = *Meshes[0];
+  if (!Mesh.StaticMesh || Mesh.IsInstanced() || !Mesh.StaticMesh->GetComponentTransform().Equals(Transform))
+    return nullptr;
+
+  const UStaticMesh* StaticMesh = Mesh.StaticMesh->GetStaticMesh();
+  if (!StaticMesh || !StaticMesh->GetRenderData() || StaticMesh->GetRenderData()->LODResources.IsEmpty())
+    return nullptr;
+
+  const int32 LodGroupToUse = FMath::Clamp(Mesh.LOD, 0, StaticMesh->GetRenderData()->LODResources.Num() - 1);
+  const FStaticMeshLODResources& Model = StaticMesh->GetRenderData()->LODResources[LodGroupToUse];
+  const FPositionVertexBuffer& VertexBuffer = Model.VertexBuffers.PositionVertexBuffer;
+  // The CPU copies are discarded once uploaded to the GPU unless the mesh allows CPU access
+  if (VertexBuffer.GetNumVertices() == 0 || VertexBuffer.GetVertexData() == nullptr || Model.IndexBuffer.GetNumIndices() == 0)
+    return nullptr;
+
+  const void* IndexData =
+      Model.IndexBuffer.Is32Bit() ? static_cast<const void*>(Model.IndexBuffer.AccessStream32()) : Model.IndexBuffer.AccessStream16();
+  return IndexData != nullptr ? &Model : nullptr;
+}
+
+// Simplifies a single mesh in its own local space (OVR axes) and captures the SDK's serialized result
+static bool SimplifyPrototype(
+    ovrAudioContext Context,
+    FMetaXRAcousticMaterialRefs& MaterialRefs,
+    const AcousticMesh& Mesh,
+    const bool bUseSimpleCollision,
+    const ovrAudioMeshSimplification& Simplification,
+    TArray<uint8>& OutMeshData) {
+  const UStaticMesh* StaticMesh = Mesh.StaticMesh->GetStaticMesh();
+
+  TArray<ovrAudioMeshGroup> MeshGroups{};
+  FMeshStagingArrays Staging;
+  int32 VertexOffset = 0;
+  int32 IndexOffset = 0;
+  int32 GroupOffset = 0;
+  FCollisionMesh CollisionMesh;
+  if (bUseSimpleCollision && BuildCollisionMesh(StaticMesh, CollisionMesh)) {
+    MeshGroups.SetNumUninitialized(1);
+    Staging.Init(CollisionMesh.Vertices.Num(), CollisionMesh.Indices.Num());
+    if (!UploadCollisionMeshFilter(
+            MaterialRefs, MeshGroups, Staging, VertexOffset, IndexOffset, GroupOffset, CollisionMesh, Mesh.Materials, {FMatrix::Identity}))
+      return false;
+  } else {
+    const int32 LodGroupToUse = FMath::Clamp(Mesh.LOD, 0, StaticMesh->GetRenderData()->LODResources.Num() - 1);
+    const FStaticMeshLODResources& Model = StaticMesh->GetRenderData()->LODResources[LodGroupToUse];
+    MeshGroups.SetNumUninitialized(Model.Sections.Num());
+    Staging.Init(Model.VertexBuffers.PositionVertexBuffer.GetNumVertices(), Model.IndexBuffer.GetNumIndices());
+
+    TArray<FMeshTransformJob> Jobs;
+    if (!UploadMeshFilter(
+            MaterialRefs,
+            MeshGroups,
+            Jobs,
+            VertexOffset,
+            IndexOffset,
+            GroupOffset,
+            StaticMesh,
+            Mesh.LOD,
+            Mesh.Materials,
+            FMatrix::Identity))
+      return false;
+    ParallelFor(Jobs.Num(), [&Jobs, &Staging](int32 JobIndex) { RunMeshTransformJob(Jobs[JobIndex], Staging); });
+  }
+
+  ovrAudioGeometry Geometry = nullptr;
+  if (OVRA_CALL(ovrAudio_CreateAudioGeometry)(Context, &Geometry) != ovrSuccess) {
+    METAXR_AUDIO_LOG_WARNING("Unable to create prototype audio geometry");
+    return false;
+  }
+
+  ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometryUploadSimplifiedMeshArrays)(
+      Geometry,
+      Staging.Vertices.GetData(),
+      0,
+      Staging.Vertices.Num(),
+      0,
+      ovrAudioScalarType_Float32,
+      Staging.GetIndexData(),
+      0,
+      Staging.GetIndexCount(),
+      Staging.GetIndexType(),
+      MeshGroups.GetData(),
+      MeshGroups.Num(),
+      &Simplification);
+  if (Result == ovrSuccess) {
+    OutMeshData.Reset();
+    FMetaXRAudioArraySerializer Writer(OutMeshData);
+    const ovrAudioSerializer Serializer = Writer.GetSerializer();
+    Result = OVRA_CALL(ovrAudio_AudioGeometryWriteMeshData)(Geometry, &Serializer);
+  }
+
+  if (OVRA_CALL(ovrAudio_DestroyAudioGeometry)(Geometry) != ovrSuccess)
+    METAXR_AUDIO_LOG_WARNING("Failed to destroy prototype geometry handle");
+
+  if (Result != ovrSuccess) {
+    METAXR_AUDIO_LOG_WARNING("Failed simplifying instanced mesh %s", *StaticMesh->GetName());
+    return false;
+  }
+  return true;
+}
+
+// Simplify each unique mesh/LOD/material combination among the instanced meshes once, and record every instance's placement
+static bool BuildInstancePrototypes(
+    ovrAudioContext Context,
+    FMetaXRAcousticMaterialRefs& MaterialRefs,
+    const TArray<const AcousticMesh*>& Meshes,
+    const FMatrix& AcousticGeoCompWM,
+    const bool bUseSimpleCollision,
+    const ovrAudioMeshSimplification& Simplification,
+    TArray<FMetaXRAcousticPrototype>& OutPrototypes) {
+  // Instance counts are large but unique combinations are few, so a linear search is fine here
+  TArray<const AcousticMesh*> UniqueMeshes;
+  for (const AcousticMesh* Mesh : Meshes) {
+    int32 PrototypeIndex = UniqueMeshes.IndexOfByPredicate([Mesh](const AcousticMesh* Unique) {
+      return Unique->StaticMesh->GetStaticMesh() == Mesh->StaticMesh->GetStaticMesh() && Unique->LOD == Mesh->LOD &&
+          Unique->Materials == Mesh->Materials;
+    });
+
+    if (PrototypeIndex == INDEX_NONE) {
+      FMetaXRAcousticPrototype Prototype;
+      if (!SimplifyPrototype(Context, MaterialRefs, *Mesh, bUseSimpleCollision, Simplification, Prototype.MeshData))
+        return false;
+
+      PrototypeIndex = OutPrototypes.Add(MoveTemp(Prototype));
+      UniqueMeshes.Add(Mesh);
+    }
+
+    FMetaXRAcousticPrototype& Prototype = OutPrototypes[PrototypeIndex];
+    const int32 InstanceCount = Mesh->GetInstancedCount();
+    Prototype.Transforms.Reserve(Prototype.Transforms.Num() + InstanceCount);
+    for (int32 InstanceID = 0; InstanceID < InstanceCount; InstanceID++) {
+      FMatrix LocalMatrix;
+      if (!Mesh->GetAcousticMeshLocalMatrix(AcousticGeoCompWM, InstanceID, LocalMatrix))
+        return false;
+      Prototype.Transforms.Add(FMatrix44f(LocalMatrix));
+    }
+  }
+
+  METAXR_AUDIO_LOG("Simplified %i instanced meshes as %i prototypes", Meshes.Num(), OutPrototypes.Num());
+  return true;
+}
+
+// Everything the final upload of a gathered geometry needs. It holds no UObjects, so the cleanup, remeshing and simplification
+// it runs can happen off the game thread.
+struct FMeshSubmission {
+  TArray<ovrAudioMeshGroup> MeshGroups;
+  FMeshStagingArrays Staging;
+  // Set when a single mesh is uploaded straight from its render data instead of from the staging arrays
+  const FStaticMeshLODResources* MeshSpaceModel = nullptr;
+  UStaticMesh* MeshSpaceMesh = nullptr;
+  ovrAudioMeshSimplification Simplification{};
+  bool bCleanMesh = false;
+  float WeldTolerance = 0.0f;
+  bool bVoxelShell = false;
+  float VoxelShellSize = 0.0f;
+  bool bCullInteriorFaces = false;
+  float InteriorCullVoxelSize = 0.0f;
+  TArray<FVector3f> ReachabilitySeeds;
+  // Names the geometry in logs
+  FString Name;
+
+  // Everything was placed through prototypes or landscape tiles
+  bool IsEmpty() const {
+    return MeshSpaceModel == nullptr && Staging.Vertices.IsEmpty();
+  }
+};
+
+// Cleans, remeshes and orders the staged mesh, then simplifies it into GeometryHandle
+static ovrResult SubmitMesh(ovrAudioGeometry GeometryHandle, FMeshSubmission& Submission) {
+  if (Submission.IsEmpty())
+    return ovrSuccess;
+
+  TArray<ovrAudioMeshGroup>& MeshGroups = Submission.MeshGroups;
+  if (Submission.MeshSpaceModel != nullptr) {
+    const FPositionVertexBuffer& VertexBuffer = Submission.MeshSpaceModel->VertexBuffers.PositionVertexBuffer;
+    const FRawStaticIndexBuffer& IndexBuffer = Submission.MeshSpaceModel->IndexBuffer;
+    METAXR_AUDIO_LOG("Uploading mesh %s with %i vertices directly from render data", *Submission.Name, VertexBuffer.GetNumVertices());
+
+    const bool b32BitIndices = IndexBuffer.Is32Bit();
+    return OVRA_CALL(ovrAudio_AudioGeometryUploadSimplifiedMeshArrays)(
+        GeometryHandle,
+        VertexBuffer.GetVertexData(),
+        0,
+        VertexBuffer.GetNumVertices(),
+        VertexBuffer.GetStride(),
+        ovrAudioScalarType_Float32,
+        b32BitIndices ? static_cast<const void*>(IndexBuffer.AccessStream32()) : IndexBuffer.AccessStream16(),
+        0,
+        IndexBuffer.GetNumIndices(),
+        b32BitIndices ? ovrAudioScalarType_UInt32 : ovrAudioScalarType_UInt16,
+        MeshGroups.GetData(),
+        MeshGroups.Num(),
+        &Submission.Simplification);
+  }
+
+  FMeshStagingArrays& Staging = Submission.Staging;
+  if (Submission.bCleanMesh) {
+    const FMeshCleanupStats Stats = CleanMeshStaging(Staging, MeshGroups, Submission.WeldTolerance);
+    METAXR_AUDIO_LOG(
+        "Cleaned mesh %s: welded %i vertices, removed %i degenerate and %i duplicate faces",
+        *Submission.Name,
+        Stats.WeldedVertices,
+        Stats.DegenerateFaces,
+        Stats.DuplicateFaces);
+  }
+
+  // The shell has no interior faces left to cull
+  if (Submission.bVoxelShell) {
+    const int32 ShellTriangles = RemeshVoxelShell(Staging, MeshGroups, Submission.VoxelShellSize, Submission.ReachabilitySeeds);
+    METAXR_AUDIO_LOG("Remeshed mesh %s as a voxel shell of %i triangles", *Submission.Name, ShellTriangles);
+  } else if (Submission.bCullInteriorFaces) {
+    const int32 CulledFaces = CullInteriorFaces(Staging, MeshGroups, Submission.InteriorCullVoxelSize, Submission.ReachabilitySeeds);
+    METAXR_AUDIO_LOG("Culled %i interior faces of mesh %s", CulledFaces, *Submission.Name);
+  }
+
+  SortMeshStaging(Staging, MeshGroups);
+
+  METAXR_AUDIO_LOG(
+      "Uploading mesh %s with %i vertices (%s indices)",
+      *Submission.Name,
+      Staging.Vertices.Num(),
+      Staging.Uses16BitIndices() ? TEXT("16-bit") : TEXT("32-bit"));
+
+  return OVRA_CALL(ovrAudio_AudioGeometryUploadSimplifiedMeshArrays)(
+      GeometryHandle,
+      Staging.Vertices.GetData(),
+      0,
+      Staging.Vertices.Num(),
+      0,
+      ovrAudioScalarType_Float32,
+      Staging.GetIndexData(),
+      0,
+      Staging.GetIndexCount(),
+      Staging.GetIndexType(),
+      MeshGroups.GetData(),
+      MeshGroups.Num(),
+      &Submission.Simplification);
+}
+
+// A movable geometry being simplified on a worker into a handle of its own, which replaces OvrGeometry once it is done
+struct FAcousticGeometryAsyncUpload {
+  explicit FAcousticGeometryAsyncUpload(ovrAudioContext Context) : MaterialRefs(Context) {}
+
+  ~FAcousticGeometryAsyncUpload() {
+    FPlatformProcess::ReturnSynchEventToPool(DoneEvent);
+  }
+
+  ovrAudioGeometry Geometry = nullptr;
+  FMeshSubmission Submission;
+  FMetaXRAcousticMaterialRefs MaterialRefs;
+  // Keeps the render data of a mesh space upload alive while the worker reads it
+  TStrongObjectPtr<UStaticMesh> MeshSpaceMesh;
+  std::atomic<bool> bCancelled{false};
+  bool bSucceeded = false;
+  // Triggered once no thread will touch Geometry again
+  FEvent* DoneEvent = FPlatformProcess::GetSynchEventFromPool(true);
+
+  // Called on the game thread once the upload was swapped in or abandoned. Destroys the handle unless it was taken and lets go of
+  // what the worker needed.
+  void Release() {
+    if (Geometry != nullptr && OVRA_CALL(ovrAudio_DestroyAudioGeometry)(Geometry) != ovrSuccess)
+      METAXR_AUDIO_LOG_WARNING("Unable to destroy geometry");
+    Geometry = nullptr;
+    FMetaXRAcousticMaterialRefs::ReleaseAll(MaterialRefs.Detach());
+    MeshSpaceMesh.Reset();
+  }
+};
+
+// Uploads whose component stopped waiting for them. The SDK can't be interrupted mid simplification, so each is released by its
+// own completion, or by FlushAbandonedWork when the context goes away first. Only touched on the game thread.
+static TArray<TSharedRef<FAcousticGeometryAsyncUpload>> AbandonedUploads;
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Movable geometry is gathered on the game thread but simplified on a worker into a second handle, so spawning it doesn't hitch
+// the frame. OvrGeometry stays live, empty at first, until FinishGeometryUpload swaps the simplified handle in.
+bool UMetaXRAcousticGeometry::UploadGeometry() {
+  if (CachedContext == nullptr)
+    return false;
+  CancelGeometryUpload();
+
+  int IgnoredMeshCount = 0;
+  TArray<FMetaXRAcousticPrototype> Prototypes;
+  const TSharedRef<FAcousticGeometryAsyncUpload> Upload = MakeShared<FAcousticGeometryAsyncUpload>(CachedContext);
+  if (!StageMesh(IsPlaymodeActive(), true, Upload->MaterialRefs, Upload->Submission, IgnoredMeshCount, &Prototypes))
+    return false;
+  if (!CreateInstanceGeometries(MoveTemp(Prototypes)))
+    return false;
+
+  if (IgnoredMeshCount != 0) {
+    METAXR_AUDIO_LOG_WARNING(
+        "Failed to upload meshes, %i static meshes ignored. Turn on \"File Enabled\" to process static meshes offline", IgnoredMeshCount);
+  }
+
+  if (OVRA_CALL(ovrAudio_CreateAudioGeometry)(CachedContext, &Upload->Geometry) != ovrSuccess) {
+    METAXR_AUDIO_LOG_WARNING("Failed creating acoustic geometry object.");
+    return false;
+  }
+  Upload->MeshSpaceMesh.Reset(Upload->Submission.MeshSpaceMesh);
+  PendingUpload = Upload;
+
+  // Completion hops back to the game thread, the only place OvrGeometry is swapped
+  const TWeakObjectPtr<UMetaXRAcousticGeometry> WeakThis(this);
+  Async(EAsyncExecution::ThreadPool, [WeakThis, Upload]() {
+    if (!Upload->bCancelled)
+      Upload->bSucceeded = SubmitMesh(Upload->Geometry, Upload->Submission) == ovrSuccess;
+    Upload->DoneEvent->Trigger();
+    AsyncTask(ENamedThreads::GameThread, [WeakThis, Upload]() {
+      UMetaXRAcousticGeometry* Geometry = WeakThis.Get();
+      if (Geometry != nullptr && Geometry->PendingUpload == Upload)
+        Geometry->FinishGeometryUpload(Upload);
+      AbandonedUploads.Remove(Upload);
+      Upload->Release();
+    });
+  });
+  return true;
+}
+
+void UMetaXRAcousticGeometry::FinishGeometryUpload(const TSharedRef<FAcousticGeometryAsyncUpload>& Upload) {
+  PendingUpload.Reset();
+
+  if (!Upload->bSucceeded) {
+    METAXR_AUDIO_LOG_WARNING("Failed adding geometry to the audio propagation sub-system!");
+    return;
+  } else {
+    METAXR_AUDIO_LOG("Successfully uploaded geometry %p", Upload->Geometry);
+  }
+
+  // The simplified handle is placed and enabled before the front one goes, so the geometry never drops out of the simulation.
+  // The front handle's materials outlive it for the same reason.
+  const ovrAudioGeometry FrontGeometry = OvrGeometry;
+  const TArray<ovrAudioMaterial> FrontMaterials = MoveTemp(PooledMaterials);
+  OvrGeometry = Upload->Geometry;
+  Upload->Geometry = nullptr;
+  PooledMaterials = Upload->MaterialRefs.Detach();
+  bMeshSpaceUpload = Upload->Submission.MeshSpaceModel != nullptr;
+
+  ApplyTransform();
+  SetGeometryEnabled(IsActive());
+  ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(OvrGeometry, ovrAudioObjectFlag_Static, IsStatic());
+
+  METAXR_AUDIO_LOG("Swapped geometry handle %p in for %p", OvrGeometry, FrontGeometry);
+  if (OVRA_CALL(ovrAudio_DestroyAudioGeometry)(FrontGeometry) != ovrSuccess)
+    METAXR_AUDIO_LOG_WARNING("Unable to destroy geometry");
+  FMetaXRAcousticMaterialRefs::ReleaseAll(FrontMaterials);
+
+#if WITH_EDITOR
+  UpdateGizmoMesh(OvrGeometry);
 #endif
 
-bool UMetaXRAcousticGeometry::UploadMesh(ovrAudioGeometry GeometryHandle) {
+  MarkGeometryReady();
+}
+
+void UMetaXRAcousticGeometry::CancelGeometryUpload() {
+  if (!PendingUpload.IsValid())
+    return;
+
+  // The handle must not be destroyed under the worker, so it is left to the upload's completion rather than waited for
+  PendingUpload->bCancelled = true;
+  AbandonedUploads.Add(PendingUpload.ToSharedRef());
+  PendingUpload.Reset();
+}
+
+bool UMetaXRAcousticGeometry::UploadMesh(ovrAudioGeometry GeometryHandle, TArray<FMetaXRAcousticPrototype>* OutPrototypes) {
   int32 IgnoredMeshCount = 0;
-  return UploadMesh(GeometryHandle, GetOwner(), false, IgnoredMeshCount);
+  return UploadMesh(GeometryHandle, GetOwner(), false, IgnoredMeshCount, OutPrototypes);
 }
 
 bool UMetaXRAcousticGeometry::UploadMesh(
     ovrAudioGeometry GeometryHandle,
     AActor* Owner,
     bool IgnoreStatic,
-    int& OutIgnoredMeshCount) { // output parameter
-  OutIgnoredMeshCount = 0;
+    int& OutIgnoredMeshCount, // output parameter
+    TArray<FMetaXRAcousticPrototype>* OutPrototypes) {
   if (CachedContext == nullptr)
     return false;
 
+  const bool bLiveGeometry = GeometryHandle == OvrGeometry;
+  FMetaXRAcousticMaterialRefs MaterialRefs(CachedContext);
+  FMeshSubmission Submission;
+  if (!StageMesh(IgnoreStatic, bLiveGeometry, MaterialRefs, Submission, OutIgnoredMeshCount, OutPrototypes))
+    return false;
+
+  ovrResult Result = SubmitMesh(GeometryHandle, Submission);
+  if (Result != ovrSuccess) {
+    METAXR_AUDIO_LOG_WARNING("Failed adding geometry to the audio propagation sub-system!");
+    return false;
+  } else {
+    METAXR_AUDIO_LOG("Successfully uploaded geometry %p", GeometryHandle);
+  }
+
+  // Geometry uploaded in UE axes needs the axis swap applied through its transform instead
+  if (bLiveGeometry)
+    bMeshSpaceUpload = Submission.MeshSpaceModel != nullptr;
+
+  Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(GeometryHandle, ovrAudioObjectFlag_Enabled, true);
+  Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(GeometryHandle, ovrAudioObjectFlag_Static, IsStatic());
+
+  // The live geometry keeps its pooled materials referenced so other geometries and re-uploads can reuse them. Temporary
+  // handles (e.g. for baking) let theirs go when MaterialRefs goes out of scope.
+  if (bLiveGeometry) {
+    FMetaXRAcousticMaterialRefs::ReleaseAll(PooledMaterials);
+    PooledMaterials = MaterialRefs.Detach();
+  }
+
+  return (Result == ovrSuccess);
+}
+
+bool UMetaXRAcousticGeometry::StageMesh(
+    bool IgnoreStatic,
+    bool bLiveGeometry,
+    FMetaXRAcousticMaterialRefs& MaterialRefs,
+    FMeshSubmission& OutSubmission,
+    int& OutIgnoredMeshCount,
+    TArray<FMetaXRAcousticPrototype>* OutPrototypes) {
+  OutIgnoredMeshCount = 0;
+  if (OutPrototypes)
+    OutPrototypes->Reset();
+
   CheckGeoTransformValid();
 
   // Get the child mesh objects.
-  auto Gatherer = FMeshGatherer(IgnoreStatic, bUsePhysicalMaterials, bIncludeChildren, LOD);
+  auto Gatherer = FMeshGatherer(IgnoreStatic, bUsePhysicalMaterials, bIncludeChildren, LOD, GetMinMeshSize());
   TraverseHierarchy(Gatherer);
+  GatherChunkMeshes(Gatherer);
+  SkippedMeshCount = Gatherer.GetSkippedMeshCount();
+  if (SkippedMeshCount != 0)
+    METAXR_AUDIO_LOG("Skipped %i static meshes smaller than %f cm in %s", SkippedMeshCount, GetMinMeshSize(), *GetReadableName());
+
+  OutSubmission.Simplification = GetMeshSimplification();
+  OutSubmission.Name = FilePath;
+
+  // Instanced meshes can be simplified once and placed per instance instead of merging a copy of each instance, and
+  // hierarchical instances can stand in as boxes
+  const FMeshUploadOptions UploadOptions = GetMeshUploadOptions(OutPrototypes != nullptr);
+  TArray<const AcousticMesh*> MergedMeshes;
+  TArray<const AcousticMesh*> CollisionMeshes;
+  TArray<const AcousticMesh*> InstancedMeshes;
+  TArray<const AcousticMesh*> ProxyMeshes;
+  for (const auto& Mesh : Gatherer.GetMeshes()) {
+    switch (GetMeshUploadPath(Mesh, UploadOptions)) {
+      case EMeshUploadPath::Merged:
+        MergedMeshes.Add(&Mesh);
+        break;
+      case EMeshUploadPath::Collision:
+        CollisionMeshes.Add(&Mesh);
+        break;
+      case EMeshUploadPath::Prototype:
+        InstancedMeshes.Add(&Mesh);
+        break;
+      case EMeshUploadPath::Proxy:
+        ProxyMeshes.Add(&Mesh);
+        break;
+    }
+  }
 
-  int32 TotalVertexCount = 0;
-  uint32 TotalIndexCount = 0;
-  int32 TotalFaceCount = 0;
-  int32 TotalMaterialCount = 0;
-  // Update the counts for all static meshes
-  for (const auto& MeshMaterial : Gatherer.GetMeshes())
-    UpdateCountsForMesh(TotalVertexCount, TotalIndexCount, TotalFaceCount, TotalMaterialCount, MeshMaterial);
+  const FMatrix AcousticGeoCompWorldMatrix = UKismetMathLibrary::Conv_TransformToMatrix(GetComponentTransform());
+  if (!InstancedMeshes.IsEmpty() &&
+      !BuildInstancePrototypes(
+          CachedContext,
+          MaterialRefs,
+          InstancedMeshes,
+          AcousticGeoCompWorldMatrix,
+          UploadOptions.bUseSimpleCollision,
+          OutSubmission.Simplification,
+          *OutPrototypes))
+    return false;
 
-#if WITH_EDITOR
-  // Update the counts for all landscapes
-  for (const auto& LandscapeMaterial : Gatherer.GetTerrains())
-    UpdateCountsForLandscape(TotalVertexCount, TotalIndexCount, TotalFaceCount, TotalMaterialCount, LandscapeMaterial.LandscapeInfo);
-#endif
+  // Collision meshes are built once per static mesh and placed once per component or instance
+  TMap<const UStaticMesh*, FCollisionMesh> CollisionMeshCache;
+  TArray<TArray<FMatrix>> CollisionPlacements;
+  for (const AcousticMesh* Mesh : CollisionMeshes) {
+    const UStaticMesh* StaticMesh = Mesh->StaticMesh->GetStaticMesh();
+    if (!CollisionMeshCache.Contains(StaticMesh))
+      BuildCollisionMesh(StaticMesh, CollisionMeshCache.Add(StaticMesh));
+    if (!GetAcousticMeshLocalMatrices(*Mesh, AcousticGeoCompWorldMatrix, CollisionPlacements.AddDefaulted_GetRef()))
+      return false;
+  }
 
-  TArray<ovrAudioMeshGroup> MeshGroups{};
-  MeshGroups.SetNumUninitialized(TotalMaterialCount);
-  TArray<FVector> Vertices{};
-  Vertices.SetNumUninitialized(TotalVertexCount);
-  TArray<uint32> Indices{};
-  Indices.SetNumUninitialized(TotalIndexCount);
+  // Each proxied mesh is either placed as its simple collision once per instance, or replaced by boxes. Meshes without usable
+  // simple collision fall back to a box per instance.
+  TArray<TArray<FMatrix>> ProxyPlacements;
+  TArray<const UStaticMesh*> ProxyCollisionMeshes;
+  for (const AcousticMesh* Mesh : ProxyMeshes) {
+    const UStaticMesh* StaticMesh = Mesh->StaticMesh->GetStaticMesh();
+    TArray<FMatrix>& Placements = ProxyPlacements.AddDefaulted_GetRef();
+    bool bUseCollision = false;
+    if (InstanceProxy == EMetaXRAcousticInstanceProxy::InstanceCollision) {
+      if (!CollisionMeshCache.Contains(StaticMesh))
+        BuildCollisionMesh(StaticMesh, CollisionMeshCache.Add(StaticMesh));
+      bUseCollision = !CollisionMeshCache[StaticMesh].Indices.IsEmpty();
+    }
+    ProxyCollisionMeshes.Add(bUseCollision ? StaticMesh : nullptr);
 
-  int32 VertexOffset = 0;
-  int32 IndexOffset = 0;
-  int32 GroupOffset = 0;
-  // Append each static meshes details to the aggregate arrays
-  const FMatrix AcousticGeoCompWorldMatrix = UKismetMathLibrary::Conv_TransformToMatrix(GetComponentTransform());
-  for (const auto& Mesh : Gatherer.GetMeshes()) {
-    if (!HandleNextMeshFilterUpload(
-            CachedContext, MeshGroups, Vertices, Indices, VertexOffset, IndexOffset, GroupOffset, Mesh, AcousticGeoCompWorldMatrix)) {
+    if (bUseCollision) {
+      if (!GetAcousticMeshLocalMatrices(*Mesh, AcousticGeoCompWorldMatrix, Placements))
+        return false;
+      METAXR_AUDIO_LOG("Representing %i instances of %s with their simple collision", Placements.Num(), *Mesh->StaticMesh->GetName());
+      continue;
+    }
+
+    const EMetaXRAcousticInstanceProxy BoxProxy =
+        InstanceProxy == EMetaXRAcousticInstanceProxy::ClusterBox ? InstanceProxy : EMetaXRAcousticInstanceProxy::InstanceBox;
+    if (!BuildInstanceProxyBoxes(*Mesh, AcousticGeoCompWorldMatrix, BoxProxy, InstanceProxyClusterSize, Placements))
+      return false;
+    METAXR_AUDIO_LOG(
+        "Representing %i instances of %s with %i proxy boxes", Mesh->GetInstancedCount(), *Mesh->StaticMesh->GetName(), Placements.Num());
+  }
+
+  // Only the live runtime geometry may keep UE axes; geometry that gets baked to file must be in OVR axes.
+  // The mesh space upload hands the render data over as is, so it is only taken when the mesh isn't to be cleaned or culled first.
+  const bool bHasTerrains = !Gatherer.GetTerrains().IsEmpty();
+  const bool bHasOtherGeometry = !CollisionMeshes.IsEmpty() || !ProxyMeshes.IsEmpty();
+  const FStaticMeshLODResources* MeshSpaceModel = (IgnoreStatic && bLiveGeometry && !bVoxelShell && !bCleanMesh && !bCullInteriorFaces)
+      ? FindMeshSpaceModel(MergedMeshes, bHasOtherGeometry, GetComponentTransform())
+      : nullptr;
+
+  TArray<ovrAudioMeshGroup>& MeshGroups = OutSubmission.MeshGroups;
+  if (MergedMeshes.IsEmpty() && !bHasOtherGeometry && (!InstancedMeshes.IsEmpty() || bHasTerrains)) {
+    // Everything is placed through prototypes or landscape tiles; the main geometry stays empty
+  } else if (MeshSpaceModel) {
+    const AcousticMesh& Mesh = *MergedMeshes[0];
+    MeshGroups.SetNumUninitialized(MeshSpaceModel->Sections.Num());
+    if (!CreateSectionMeshGroups(MaterialRefs, MeshGroups, 0, 0, *MeshSpaceModel, Mesh.Materials))
+      return false;
+    OutSubmission.MeshSpaceModel = MeshSpaceModel;
+    OutSubmission.MeshSpaceMesh = Mesh.StaticMesh->GetStaticMesh();
+  } else {
+    int32 TotalVertexCount = 0;
+    uint32 TotalIndexCount = 0;
+    int32 TotalFaceCount = 0;
+    int32 TotalMaterialCount = 0;
+    // Update the counts for all static meshes
+    for (const AcousticMesh* MeshMaterial : MergedMeshes)
+      UpdateCountsForMesh(TotalVertexCount, TotalIndexCount, TotalFaceCount, TotalMaterialCount, *MeshMaterial);
+
+    // Each collision-sourced mesh is one group holding all of its placements
+    for (int32 Index = 0; Index < CollisionMeshes.Num(); Index++) {
+      const FCollisionMesh& CollisionMesh = CollisionMeshCache[CollisionMeshes[Index]->StaticMesh->GetStaticMesh()];
+      const int32 PlacementCount = CollisionPlacements[Index].Num();
+      TotalVertexCount += PlacementCount * CollisionMesh.Vertices.Num();
+      TotalIndexCount += PlacementCount * CollisionMesh.Indices.Num();
+      TotalFaceCount += PlacementCount * CollisionMesh.Indices.Num() / 3;
+      TotalMaterialCount++;
+    }
+
+    // Each proxied mesh is one group of collision placements or boxes
+    for (int32 Index = 0; Index < ProxyMeshes.Num(); Index++) {
+      const int32 PlacementCount = ProxyPlacements[Index].Num();
+      if (ProxyCollisionMeshes[Index] != nullptr) {
+        const FCollisionMesh& CollisionMesh = CollisionMeshCache[ProxyCollisionMeshes[Index]];
+        TotalVertexCount += PlacementCount * CollisionMesh.Vertices.Num();
+        TotalIndexCount += PlacementCount * CollisionMesh.Indices.Num();
+        TotalFaceCount += PlacementCount * CollisionMesh.Indices.Num() / 3;
+      } else {
+        TotalVertexCount += PlacementCount * ProxyBoxVertexCount;
+        TotalIndexCount += PlacementCount * ProxyBoxIndexCount;
+        TotalFaceCount += PlacementCount * 6;
+      }
+      TotalMaterialCount++;
+    }
+
+    MeshGroups.SetNumUninitialized(TotalMaterialCount);
+    FMeshStagingArrays& Staging = OutSubmission.Staging;
+    Staging.Init(TotalVertexCount, TotalIndexCount);
+
+    int32 VertexOffset = 0;
+    int32 IndexOffset = 0;
+    int32 GroupOffset = 0;
+    // Plan where each static mesh lands in the aggregate arrays, then fill them in parallel
+    TArray<FMeshTransformJob> Jobs;
+    for (const AcousticMesh* Mesh : MergedMeshes) {
+      if (!HandleNextMeshFilterUpload(
+              MaterialRefs, MeshGroups, Jobs, VertexOffset, IndexOffset, GroupOffset, *Mesh, AcousticGeoCompWorldMatrix)) {
+        return false;
+      }
+    }
+    ParallelFor(Jobs.Num(), [&Jobs, &Staging](int32 JobIndex) { RunMeshTransformJob(Jobs[JobIndex], Staging); });
+
+    // Append the collision meshes and then the instance proxies after the meshes
+    for (int32 Index = 0; Index < CollisionMeshes.Num(); Index++) {
+      const AcousticMesh& Mesh = *CollisionMeshes[Index];
+      if (!UploadCollisionMeshFilter(
+              MaterialRefs,
+              MeshGroups,
+              Staging,
+              VertexOffset,
+              IndexOffset,
+              GroupOffset,
+              CollisionMeshCache[Mesh.StaticMesh->GetStaticMesh()],
+              Mesh.Materials,
+              CollisionPlacements[Index]))
+        return false;
+    }
+
+    for (int32 Index = 0; Index < ProxyMeshes.Num(); Index++) {
+      UMetaXRAcousticMaterialProperties* ProxyMaterial = GetInstanceProxyMaterial(ProxyMeshes[Index]->Materials);
+      const TArray<FMatrix>& Placements = ProxyPlacements[Index];
+      const bool bUploaded = ProxyCollisionMeshes[Index] != nullptr
+          ? UploadCollisionMeshFilter(
+                MaterialRefs,
+                MeshGroups,
+                Staging,
+                VertexOffset,
+                IndexOffset,
+                GroupOffset,
+                CollisionMeshCache[ProxyCollisionMeshes[Index]],
+                {ProxyMaterial},
+                Placements)
+          : UploadInstanceProxyFilter(MaterialRefs, MeshGroups, Staging, VertexOffset, IndexOffset, GroupOffset, Placements, ProxyMaterial);
+      if (!bUploaded)
+        return false;
+    }
+
+    if (TotalVertexCount == 0) {
+      METAXR_AUDIO_LOG_ERROR("Unable to upload mesh, vertex count is zero %s", *FilePath);
       return false;
     }
+
+    OutSubmission.bCleanMesh = bCleanMesh;
+    OutSubmission.WeldTolerance = WeldTolerance;
+    OutSubmission.bVoxelShell = bVoxelShell;
+    OutSubmission.VoxelShellSize = VoxelShellSize;
+    OutSubmission.bCullInteriorFaces = bCullInteriorFaces;
+    OutSubmission.InteriorCullVoxelSize = InteriorCullVoxelSize;
+    if (bVoxelShell || bCullInteriorFaces)
+      OutSubmission.ReachabilitySeeds = GetReachabilitySeeds();
+  }
+
+#if WITH_EDITOR
+  // Need to remap the gizmo materials after a bake
+  if (GizmoData) {
+    FScopeLock LockGuard(&GizmoUpdateCS);
+    GizmoData->MapGizmoMaterials(
+        Gatherer, UploadOptions, [this](const AcousticMesh& Mesh) { return GetInstanceProxyMaterial(Mesh.Materials); });
+  }
+  HierarchyHash = ComputeHash();
+#endif
+
+  return true;
+}
+#pragma endregion
+
+bool UMetaXRAcousticGeometry::DestroyInternal() {
+  return DestroyPropagationGeometry();
+}
+
+bool UMetaXRAcousticGeometry::DestroyPropagationGeometry() {
+  if (OvrGeometry == nullptr)
+    return false;
+
+  // A load still in flight takes the handle over and destroys it once done
+  const bool bHandedToLoad = CancelGeometryLoad();
+  CancelGeometryUpload();
+  // A despawning pooled geometry leaves its handle and the materials it references to the next spawn
+  const bool bRecycled = !bHandedToLoad && CanReleaseToPool() &&
+      FMetaXRAcousticGeometryPool::Get().Release(CachedContext, PoolKey, OvrGeometry, PooledMaterials, bMeshSpaceUpload, PoolSize);
+  bGeometryReady = false;
+  bMeshSpaceUpload = false;
+  if (!bRecycled)
+    FMetaXRAcousticMaterialRefs::ReleaseAll(PooledMaterials);
+  PooledMaterials.Empty();
+  DestroyInstanceGeometries();
+  DestroyDistantLevels();
+  DestroyLandscapeTiles();
+
+  if (bHandedToLoad) {
+    METAXR_AUDIO_LOG("Left geometry handle %p to its abandoned load", OvrGeometry);
+  } else if (bRecycled) {
+    METAXR_AUDIO_LOG("Released geometry handle %p to the pool", OvrGeometry);
+  } else {
+    METAXR_AUDIO_LOG("Destroying geometry handle %p", OvrGeometry);
+    ovrResult Result = OVRA_CALL(ovrAudio_DestroyAudioGeometry)(OvrGeometry);
+    if (Result != ovrSuccess)
+      METAXR_AUDIO_LOG_WARNING("Unable to destroy geometry");
   }
 
-#if WITH_EDITOR
-  // Append each landscape materials details to the aggregate arrays
-  for (const auto& Landscape : Gatherer.GetTerrains()) {
-    if (!UploadLandscapeFilter(
-            CachedContext, MeshGroups, Vertices, Indices, VertexOffset, IndexOffset, GroupOffset, Landscape, AcousticGeoCompWorldMatrix)) {
-      return false;
-    }
-  }
-#endif
+  OvrGeometry = nullptr;
+  return true;
+}
+
+void UMetaXRAcousticGeometry::TraverseHierarchy(ITransformVisitor& Visitor) const {
+  if (TraversalMode == ETraversalMode::Default || TraversalMode == ETraversalMode::Actor)
+    Visitor.TraverseActorHierarchy(GetOwner());
+  else if (TraversalMode == ETraversalMode::SceneComponent)
+    Visitor.TraverseSceneComponentHierarchy(this);
+  else
+    METAXR_AUDIO_LOG_ERROR("Unknown traversal mode. Cannot traverse hierarchy. Skipping...");
+}
+
+// A geometry chunk's own hierarchy is empty; the meshes it merges live in the hierarchies of its sources
+void UMetaXRAcousticGeometry::TraverseChunkSources(ITransformVisitor& Visitor) const {
+  const AMetaXRAcousticGeometryChunk* Chunk = Cast<AMetaXRAcousticGeometryChunk>(GetOwner());
+  if (Chunk == nullptr)
+    return;
+
+  for (const UMetaXRAcousticGeometry* Source : Chunk->GetSources()) {
+    if (Source != nullptr)
+      Source->TraverseHierarchy(Visitor);
+  }
+}
+
+void UMetaXRAcousticGeometry::GatherChunkMeshes(FMeshGatherer& Gatherer) const {
+  const AMetaXRAcousticGeometryChunk* Chunk = Cast<AMetaXRAcousticGeometryChunk>(GetOwner());
+  if (Chunk == nullptr)
+    return;
+
+  TArray<FMeshMaterial> Meshes;
+  Chunk->GatherMeshes(Meshes);
+  Gatherer.AddMeshes(Meshes);
+}
+
+bool UMetaXRAcousticGeometry::GatherChunkableMeshes(TArray<FMeshMaterial>& OutMeshes) const {
+  FMeshGatherer Gatherer(false, bUsePhysicalMaterials, bIncludeChildren, LOD, GetMinMeshSize());
+  TraverseHierarchy(Gatherer);
+  OutMeshes = Gatherer.GetMeshes();
+  return Gatherer.GetTerrains().IsEmpty();
+}
+
+void UMetaXRAcousticGeometry::ApplyTransform() {
+  if (OvrGeometry == nullptr) {
+    METAXR_AUDIO_LOG_ERROR("No ovrGeoemtry for MetaXRAcousticGeometry");
+    return;
+  }
+
+  // The geometry is still being parsed on a worker; the transform is applied once the load completes
+  if (PendingLoad.IsValid())
+    return;
+
+  const FTransform& UETransform = GetComponentTransform();
+  float OVRTransform[16];
+  if (bMeshSpaceUpload)
+    MetaXRAudioUtilities::ConvertUEMatrixToOVRTransform(
+        MetaXRAudioUtilities::ToOVRMeshSpaceMatrix(UETransform.ToMatrixWithScale()), OVRTransform);
+  else
+    MetaXRAudioUtilities::ConvertUETransformToOVRTransform(UETransform, OVRTransform);
+
+  ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometrySetTransform)(OvrGeometry, OVRTransform);
+  if (Result != ovrSuccess) {
+    METAXR_AUDIO_LOG("Failed at setting new audio propagation mesh transform!");
+    return;
+  } else {
+    METAXR_AUDIO_LOG("Set transform for geometry %p", OvrGeometry);
+  }
+
+  if (Instances.IsValid()) {
+    const FMatrix ComponentMatrix = UETransform.ToMatrixWithScale();
+    for (const FAcousticGeometryInstances::FInstance& Instance : Instances->Geometries) {
+      MetaXRAudioUtilities::ConvertUEMatrixToOVRTransform(Instance.LocalMatrix * ComponentMatrix, OVRTransform);
+      if (OVRA_CALL(ovrAudio_AudioGeometrySetTransform)(Instance.Geometry, OVRTransform) != ovrSuccess)
+        METAXR_AUDIO_LOG("Failed at setting new audio propagation mesh transform!");
+    }
+  }
+
+  // Levels are only ever read from files and tiles are built, both always in OVR axes
+  MetaXRAudioUtilities::ConvertUETransformToOVRTransform(UETransform, OVRTransform);
+  if (Levels.IsValid()) {
+    for (ovrAudioGeometry Geometry : Levels->Geometries) {
+      if (OVRA_CALL(ovrAudio_AudioGeometrySetTransform)(Geometry, OVRTransform) != ovrSuccess)
+        METAXR_AUDIO_LOG("Failed at setting new audio propagation mesh transform!");
+    }
+  }
+  if (LandscapeTiles.IsValid()) {
+    for (const FAcousticGeometryLandscapeTiles::FTile& Tile : LandscapeTiles->Tiles) {
+      if (OVRA_CALL(ovrAudio_AudioGeometrySetTransform)(Tile.Geometry, OVRTransform) != ovrSuccess)
+        METAXR_AUDIO_LOG("Failed at setting new audio propagation mesh transform!");
+    }
+  }
+
+  PreviousTransform = UETransform;
+  PreviousGeometry = OvrGeometry;
+}
+
+// Parses a geometry file without staging it in a heap copy: from a memory-mapped view where the platform supports it,
+// otherwise streamed through a file handle.
+static ovrResult ReadGeometryFromFile(
+    ovrAudioGeometry GeometryHandle,
+    const FString& FullFilePath,
+    const FString& SourceHash,
+    FMetaXRAcousticGeometrySections& OutSections) {
+  IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+  TUniquePtr<IMappedFileHandle> MappedHandle(PlatformFile.OpenMapped(*FullFilePath));
+  if (MappedHandle.IsValid()) {
+    TUniquePtr<IMappedFileRegion> MappedRegion(MappedHandle->MapRegion());
+    if (MappedRegion.IsValid()) {
+      FMetaXRAudioMemorySerializer MemorySerializer(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize());
+      return FMetaXRAcousticContainer::ReadGeometry(GeometryHandle, MemorySerializer.GetSerializer(), &OutSections, SourceHash);
+    }
+  }
+
+  TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenRead(*FullFilePath));
+  if (!FileHandle.IsValid())
+    return ovrError_AudioInvalidParam;
+
+  FMetaXRAudioFileSerializer FileSerializer(FileHandle.Get());
+  return FMetaXRAcousticContainer::ReadGeometry(GeometryHandle, FileSerializer.GetSerializer(), &OutSections, SourceHash);
+}
+
+bool UMetaXRAcousticGeometry::ReadFile() {
+  const bool bHasBakedData = BakedData != nullptr && BakedData->HasPayload();
+  if (FilePath.IsEmpty() && !bHasBakedData) {
+    METAXR_AUDIO_LOG_WARNING("No geometry file path provided!");
+    return false;
+  }
+
+  if (IsPlaymodeActive()) {
+    LoadGeometryAsync();
+    return true;
+  } else {
+    const FString FullFilePath = FPaths::ProjectContentDir() / FilePath;
+    if (!FPaths::FileExists(FullFilePath)) {
+      METAXR_AUDIO_LOG_WARNING("Audio geometry file not found: %s", *FullFilePath);
+      return false;
+    }
+
+    FMetaXRAcousticGeometrySections Sections;
+    ovrResult Result = ReadGeometryFromFile(OvrGeometry, FullFilePath, HierarchyHash, Sections);
+    if (Result != ovrSuccess || !CreateGeometrySections(MoveTemp(Sections))) {
+      METAXR_AUDIO_LOG_WARNING("Unable to read audio geometry from file: %s", *FullFilePath);
+      return false;
+    } else {
+      METAXR_AUDIO_LOG("Successfully read geometry from file: %s", *FullFilePath);
+    }
+
+    Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(OvrGeometry, ovrAudioObjectFlag_Enabled, true);
+    Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(OvrGeometry, ovrAudioObjectFlag_Static, IsStatic());
+  }
+
+#if WITH_EDITOR
+  UpdateGizmoMesh(OvrGeometry);
+#endif
+  return true;
+}
+
+// See: FMetaXRAcousticGeometryDetails
+bool UMetaXRAcousticGeometry::WriteFile() {
+  // Geometry spawned by a bake (e.g. chunks) hasn't ticked in the editor yet
+  if (CachedContext == nullptr && !GetOVRAContext(CachedContext, GetOwner(), GetWorld()))
+    return false;
+
+  // Create a temporary geometry.
+  ovrAudioGeometry tempGeometryHandle;
+  ovrResult Result = OVRA_CALL(ovrAudio_CreateAudioGeometry)(CachedContext, &tempGeometryHandle);
+  if (Result != ovrSuccess) {
+    METAXR_AUDIO_LOG_WARNING("Unable to create temp audio geometry");
+    return false;
+  } else {
+    METAXR_AUDIO_LOG("Created new temporary geometry handle %p", tempGeometryHandle);
+  }
+
+  // Upload the mesh geometry and then write the result to disk. The distant levels go first so the gizmo keeps the
+  // material mapping of the main upload.
+  bool Succeeded = false;
+  FMetaXRAcousticGeometrySections Sections;
+  if (BuildDistantLevels(Sections) && UploadMesh(tempGeometryHandle, &Sections.Prototypes)) {
+    if (WriteFileInternal(tempGeometryHandle, &Sections)) {
+      Succeeded = true;
+#if WITH_EDITOR
+      bNeedsRebake = false;
+#endif // WITH_EDITOR
+    }
+  }
+
+  // Destroy the geometry.
+  METAXR_AUDIO_LOG("Destroying temporary geometry handle %p", tempGeometryHandle);
+  if (OVRA_CALL(ovrAudio_DestroyAudioGeometry)(tempGeometryHandle) != ovrSuccess) {
+    METAXR_AUDIO_LOG_WARNING("Failed to destroy temp geometry handle");
+    Succeeded = false;
+  }
+
+  return Succeeded;
+}
+
+bool UMetaXRAcousticGeometry::WriteFileInternal(ovrAudioGeometry GeometryHandle, const FMetaXRAcousticGeometrySections* Sections) {
+  // Setup the filepaths for the output file
+#if WITH_EDITOR
+  GenerateFileNameIfEmpty();
+#endif
+  const FString FullFilePath = FPaths::ProjectContentDir() / FilePath;
+#if WITH_EDITOR
+  MetaXRAudioUtilities::CreateMetaXRAcousticContentDirectory(FPaths::GetPath(FilePath));
+#endif
+
+  // Write the mesh to a file
+  ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometryWriteMeshFile)(GeometryHandle, TCHAR_TO_ANSI(*FullFilePath));
+  if (Result != ovrSuccess) {
+    METAXR_AUDIO_LOG_WARNING("Unable to save geometry to file %s", *FullFilePath);
+    return false;
+  } else {
+    METAXR_AUDIO_LOG("Successfully wrote geometry to file: %s", *FullFilePath);
+  }
+
+  // The live geometry writes back the prototypes it was placed from and the levels it was loaded with
+  FMetaXRAcousticGeometrySections LiveSections;
+  if (Sections == nullptr && GeometryHandle == OvrGeometry) {
+    if (Instances.IsValid())
+      LiveSections.Prototypes = Instances->Prototypes;
+    if (Levels.IsValid()) {
+      LiveSections.DistantLevels = Levels->Levels;
+      LiveSections.Bounds = Levels->Bounds;
+    }
+    Sections = &LiveSections;
+  }
+
+  // Sections can only be stored in a container, so they force one even when compression is off
+  const bool bHasSections = Sections != nullptr && !Sections->IsEmpty();
+  if (GetDefault<UMetaXRAcousticProjectSettings>()->bCompressBakedData || bHasSections) {
+    static const FMetaXRAcousticGeometrySections NoSections;
+    if (!FMetaXRAcousticContainer::CompressFile(FullFilePath, HierarchyHash, bHasSections ? *Sections : NoSections))
+      return false;
+  }
+  // Landscapes are never staged, they are built as tiles at startup
+  bFileExcludesLandscapes = true;
+
+#if WITH_EDITOR
+  UpdateGizmoMesh(GeometryHandle);
+#endif
+
+  if (!bFileEnabled) {
+    METAXR_AUDIO_LOG_WARNING("File Successfully written but File Enabled is off, turn it on to use file");
+  }
+
+  return true;
+}
+
+// State shared between the game thread and the IO/worker threads while a geometry file is streamed in.
+// The file handle and requests are owned here so they outlive the component if it is destroyed mid-load.
+struct FAcousticGeometryAsyncLoad {
+  FString FullFilePath;
+  ovrAudioGeometry Geometry = nullptr;
+  TUniquePtr<IAsyncReadFileHandle> FileHandle;
+  FAsyncFileCallBack SizeCallback;
+  FCriticalSection RequestCS;
+  IAsyncReadRequest* SizeRequest = nullptr;
+  std::atomic<bool> bCancelled{false};
+  bool bSucceeded = false;
+  FMetaXRAcousticGeometrySections Sections;
+  // The hierarchy hash the file must have been baked from
+  FString SourceHash;
+  // Key of the shared file in the geometry cache, when the file is shared
+  FString CacheKey;
+  // This load reads the shared file and leaves its template in the cache
+  bool bBuildsTemplate = false;
+  FMetaXRAcousticGeometryCache::FTemplatePtr Template;
+  // This load waits for another one reading the same shared file. Whichever of the template and a cancel arrives first claims it.
+  bool bWaitsForTemplate = false;
+  std::atomic<bool> bClaimed{false};
+  // Neither the template it waited for nor the prefetched read it took arrived, so the file must be read again
+  bool bRetry = false;
+  // Cooked data the worker parses, kept alive until the load is released even if the component goes away
+  TStrongObjectPtr<const UMetaXRAcousticBakedData> BakedData;
+  // Triggered once no thread will touch Geometry again
+  FEvent* DoneEvent = FPlatformProcess::GetSynchEventFromPool(true);
+
+  ~FAcousticGeometryAsyncLoad() {
+    FPlatformProcess::ReturnSynchEventToPool(DoneEvent);
+  }
+
+  // Called on the game thread once loading is done. The callback holds a reference back to this state, so dropping it here breaks that cycle.
+  void ReleaseRequests() {
+    FScopeLock Lock(&RequestCS);
+    // Requests must be released before the handle that issued them
+    if (SizeRequest != nullptr) {
+      SizeRequest->WaitCompletion();
+      delete SizeRequest;
+      SizeRequest = nullptr;
+    }
+    FileHandle.Reset();
+    SizeCallback.Reset();
+    BakedData.Reset();
+  }
+
+  // Called on the game thread once an abandoned load is done, which took over the component's handle
+  void DestroyGeometry() {
+    if (Geometry != nullptr && OVRA_CALL(ovrAudio_DestroyAudioGeometry)(Geometry) != ovrSuccess)
+      METAXR_AUDIO_LOG_WARNING("Unable to destroy geometry");
+    Geometry = nullptr;
+  }
+};
+
+// Loads whose component stopped waiting for them while a read or parse was in flight. Each owns the handle it parses into and
+// destroys it on its own completion, or in FlushAbandonedWork when the context goes away first. Only touched on the game thread.
+static TArray<TSharedRef<FAcousticGeometryAsyncLoad>> AbandonedLoads;
+
+// Copies what Geometry was parsed into, so other handles of the same file can be parsed from memory
+static FMetaXRAcousticGeometryCache::FTemplatePtr WriteGeometryTemplate(
+    ovrAudioGeometry Geometry,
+    const FMetaXRAcousticGeometrySections& Sections,
+    const FString& FullFilePath) {
+  const TSharedRef<FMetaXRAcousticGeometryCache::FTemplate, ESPMode::ThreadSafe> Template =
+      MakeShared<FMetaXRAcousticGeometryCache::FTemplate, ESPMode::ThreadSafe>();
+  FMetaXRAudioArraySerializer Writer(Template->MeshData);
+  const ovrAudioSerializer Serializer = Writer.GetSerializer();
+  if (OVRA_CALL(ovrAudio_AudioGeometryWriteMeshData)(Geometry, &Serializer) != ovrSuccess) {
+    METAXR_AUDIO_LOG_WARNING("Unable to cache audio geometry of shared file: %s", *FullFilePath);
+    return nullptr;
+  }
+  Template->Sections = Sections;
+  return Template;
+}
+
+static bool ReadGeometryTemplate(ovrAudioGeometry Geometry, const FMetaXRAcousticGeometryCache::FTemplate& Template) {
+  FMetaXRAudioMemorySerializer MemorySerializer(Template.MeshData.GetData(), Template.MeshData.Num());
+  const ovrAudioSerializer Serializer = MemorySerializer.GetSerializer();
+  return OVRA_CALL(ovrAudio_AudioGeometryReadMeshData)(Geometry, &Serializer) == ovrSuccess;
+}
+
+// Keeps what a load of a shared file parsed so the other instances can parse their handles from memory
+static void MakeGeometryTemplate(FAcousticGeometryAsyncLoad& State) {
+  State.Template = WriteGeometryTemplate(State.Geometry, State.Sections, State.FullFilePath);
+}
+
+static bool ReadGeometryTemplate(FAcousticGeometryAsyncLoad& State, const FMetaXRAcousticGeometryCache::FTemplate& Template) {
+  if (!ReadGeometryTemplate(State.Geometry, Template))
+    return false;
+  State.Sections = Template.Sections;
+  return true;
+}
+
+// Handles read for the geometry pool ahead of the spawns that take them. The file is read once, or taken from the template a
+// load of the same shared file left in the cache, and every handle is parsed from that copy in parallel on workers.
+struct FAcousticGeometryPrewarm {
+  ovrAudioContext Context = nullptr;
+  FString PoolKey;
+  int32 PoolSize = 0;
+  FString FullFilePath;
+  FString SourceHash;
+  FString CacheKey;
+  TStrongObjectPtr<const UMetaXRAcousticBakedData> BakedData;
+  TArray<ovrAudioGeometry> Geometries;
+  TArray<bool> Succeeded;
+  // Triggered once no thread will touch Geometries again
+  FEvent* DoneEvent = FPlatformProcess::GetSynchEventFromPool(true);
+
+  ~FAcousticGeometryPrewarm() {
+    FPlatformProcess::ReturnSynchEventToPool(DoneEvent);
+  }
+
+  // Called on the game thread for the handles the pool didn't take
+  void DestroyGeometries() {
+    for (ovrAudioGeometry Geometry : Geometries) {
+      if (Geometry != nullptr && OVRA_CALL(ovrAudio_DestroyAudioGeometry)(Geometry) != ovrSuccess)
+        METAXR_AUDIO_LOG_WARNING("Unable to destroy geometry");
+    }
+    Geometries.Empty();
+    BakedData.Reset();
+  }
+};
+
+// Prewarms whose handles haven't been released into the pool yet, released by their own completion or by FlushAbandonedWork
+// when the context goes away first. Only touched on the game thread.
+static TArray<TSharedRef<FAcousticGeometryPrewarm>> PendingPrewarms;
+
+// Runs on a worker. Without a template, the file is read into the first handle and the template made from it, which is handed
+// to the cache when bBuildsTemplate.
+static void BuildPrewarmedGeometries(
+    FAcousticGeometryPrewarm& Prewarm,
+    FMetaXRAcousticGeometryCache::FTemplatePtr Template,
+    bool bBuildsTemplate) {
+  int32 FirstIndex = 0;
+  if (!Template.IsValid()) {
+    const ovrAudioGeometry Geometry = Prewarm.Geometries[0];
+    FMetaXRAcousticGeometrySections Sections;
+    bool bRead = false;
+    if (Prewarm.BakedData.IsValid()) {
+      bRead = Prewarm.BakedData->ReadPayload([&Prewarm, Geometry, &Sections](const uint8* Data, int64 Size) {
+        FMetaXRAudioMemorySerializer MemorySerializer(Data, Size);
+        return FMetaXRAcousticContainer::ReadGeometry(Geometry, MemorySerializer.GetSerializer(), &Sections, Prewarm.SourceHash) ==
+            ovrSuccess;
+      });
+    } else {
+      bRead = ReadGeometryFromFile(Geometry, Prewarm.FullFilePath, Prewarm.SourceHash, Sections) == ovrSuccess;
+    }
+    if (bRead)
+      Template = WriteGeometryTemplate(Geometry, Sections, Prewarm.FullFilePath);
+    if (bBuildsTemplate)
+      FMetaXRAcousticGeometryCache::Get().Finish(Prewarm.CacheKey, Template);
+    Prewarm.Succeeded[0] = Template.IsValid();
+    FirstIndex = 1;
+  }
+
+  // Distant levels and instances need handles of their own, which the pool doesn't keep
+  if (!Template.IsValid()) {
+    METAXR_AUDIO_LOG_WARNING("Unable to read audio geometry from file: %s", *Prewarm.FullFilePath);
+    return;
+  }
+  if (!Template->Sections.IsEmpty()) {
+    METAXR_AUDIO_LOG_WARNING("Geometry with distant levels or instances can't be pooled: %s", *Prewarm.FullFilePath);
+    Prewarm.Succeeded[0] = false;
+    return;
+  }
+
+  ParallelFor(Prewarm.Geometries.Num() - FirstIndex, [&Prewarm, &Template, FirstIndex](int32 Index) {
+    Prewarm.Succeeded[FirstIndex + Index] = ReadGeometryTemplate(Prewarm.Geometries[FirstIndex + Index], *Template);
+  });
+}
+
+static void FinishPrewarm(const TSharedRef<FAcousticGeometryPrewarm>& Prewarm) {
+  // Flushed as the world was cleaned up
+  if (PendingPrewarms.Remove(Prewarm) == 0)
+    return;
+
+  int32 ReleasedCount = 0;
+  for (int32 Index = 0; Index < Prewarm->Geometries.Num(); Index++) {
+    ovrAudioGeometry& Geometry = Prewarm->Geometries[Index];
+    if (Prewarm->Succeeded[Index] &&
+        FMetaXRAcousticGeometryPool::Get().Release(Prewarm->Context, Prewarm->PoolKey, Geometry, {}, false, Prewarm->PoolSize)) {
+      Geometry = nullptr;
+      ReleasedCount++;
+    }
+  }
+  Prewarm->DestroyGeometries();
+  METAXR_AUDIO_LOG("Prewarmed %i acoustic geometry handles of %s", ReleasedCount, *Prewarm->FullFilePath);
+}
+
+void UMetaXRAcousticGeometry::LoadGeometryAsync() {
+  // A load still in flight keeps the handle it parses into, so this one parses into a fresh handle
+  if (CancelGeometryLoad() && OVRA_CALL(ovrAudio_CreateAudioGeometry)(CachedContext, &OvrGeometry) != ovrSuccess) {
+    METAXR_AUDIO_LOG_WARNING("Failed creating acoustic geometry object.");
+    OvrGeometry = nullptr;
+    return;
+  }
+
+  const TSharedRef<FAcousticGeometryAsyncLoad> Load = MakeShared<FAcousticGeometryAsyncLoad>();
+  Load->Geometry = OvrGeometry;
+  Load->SourceHash = HierarchyHash;
+
+  // Completion always hops back to the game thread, where flags and transform are applied and listeners are notified.
+  // A load of a shared file first hands its template, or the lack of one, to the instances waiting on it.
+  const TWeakObjectPtr<UMetaXRAcousticGeometry> WeakThis(this);
+  FAcousticGeometryAsyncLoad* const State = &Load.Get();
+  const TFunction<void()> Complete = [WeakThis, Load]() {
+    if (Load->bBuildsTemplate)
+      FMetaXRAcousticGeometryCache::Get().Finish(Load->CacheKey, Load->Template);
+    Load->DoneEvent->Trigger();
+    AsyncTask(ENamedThreads::GameThread, [WeakThis, Load]() {
+      Load->ReleaseRequests();
+      UMetaXRAcousticGeometry* Geometry = WeakThis.Get();
+      if (Geometry != nullptr && Geometry->PendingLoad == Load)
+        Geometry->FinishGeometryLoad(Load);
+      if (AbandonedLoads.Remove(Load) != 0)
+        Load->DestroyGeometry();
+    });
+  };
+
+  // Instances of a Blueprint share one file: the first to load it reads it and the others parse from its template in memory
+  if (UsesSharedFile()) {
+    Load->CacheKey = GetGeometryCacheKey();
+    Load->FullFilePath = FPaths::ProjectContentDir() / FilePath;
+    const FMetaXRAcousticGeometryCache::FOnLoaded OnLoaded = [State, Complete](const FMetaXRAcousticGeometryCache::FTemplatePtr& Template) {
+      if (State->bClaimed.exchange(true))
+        return;
+      if (!Template.IsValid()) {
+        State->bRetry = true;
+        Complete();
+        return;
+      }
+      Async(EAsyncExecution::ThreadPool, [State, Complete, Template]() {
+        State->bSucceeded = !State->bCancelled && ReadGeometryTemplate(*State, *Template);
+        Complete();
+      });
+    };
+
+    FMetaXRAcousticGeometryCache& Cache = FMetaXRAcousticGeometryCache::Get();
+    bool bShouldLoad = false;
+    const FMetaXRAcousticGeometryCache::FTemplatePtr Template = Cache.Find(Load->CacheKey, OnLoaded, bShouldLoad);
+    PendingLoad = Load;
+    if (Template.IsValid()) {
+      Async(EAsyncExecution::ThreadPool, [State, Complete, Template]() {
+        State->bSucceeded = !State->bCancelled && ReadGeometryTemplate(*State, *Template);
+        Complete();
+      });
+      return;
+    }
+    if (!bShouldLoad) {
+      Load->bWaitsForTemplate = true;
+      return;
+    }
+    Load->bBuildsTemplate = true;
+  }
+
+  // Cooked data was already streamed in with the level package, so only the parse is left to do
+  if (BakedData != nullptr && BakedData->HasPayload()) {
+    Load->FullFilePath = BakedData->GetPathName();
+    Load->BakedData.Reset(BakedData);
+    PendingLoad = Load;
+    Async(EAsyncExecution::ThreadPool, [State, Complete]() {
+      State->bSucceeded = State->BakedData->ReadPayload([State](const uint8* Data, int64 Size) {
+        if (State->bCancelled)
+          return false;
+        FMetaXRAudioMemorySerializer MemorySerializer(Data, Size);
+        return FMetaXRAcousticContainer::ReadGeometry(
+                   State->Geometry, MemorySerializer.GetSerializer(), &State->Sections, State->SourceHash) == ovrSuccess;
+      });
+      if (State->bSucceeded && State->bBuildsTemplate)
+        MakeGeometryTemplate(*State);
+      Complete();
+    });
+    return;
+  }
+
+  // Failing before the read starts still has to release the instances waiting on a shared file
+  const FString FullFilePath = FPaths::ProjectContentDir() / FilePath;
+#if WITH_EDITOR
+  if (!FPaths::FileExists(FullFilePath)) {
+    METAXR_AUDIO_LOG_WARNING("Audio geometry file not found: %s", *FullFilePath);
+    PendingLoad.Reset();
+    Complete();
+    return;
+  }
+#endif
+
+  // The level manifest had the file read as the level started loading; a prefetch that failed falls back to a read of its own
+  const FMetaXRAcousticLevelPrefetch::FFileRef Prefetched = FMetaXRAcousticLevelPrefetch::Get().Take(FullFilePath);
+  if (Prefetched.IsValid()) {
+    Load->FullFilePath = FullFilePath;
+    PendingLoad = Load;
+    Async(EAsyncExecution::ThreadPool, [State, Complete, Prefetched]() {
+      if (!Prefetched->Wait()) {
+        State->bRetry = true;
+      } else if (!State->bCancelled) {
+        FMetaXRAudioMemorySerializer MemorySerializer(Prefetched->GetData(), Prefetched->GetSize());
+        const ovrResult Result = FMetaXRAcousticContainer::ReadGeometry(
+            State->Geometry, MemorySerializer.GetSerializer(), &State->Sections, State->SourceHash);
+        State->bSucceeded = (Result == ovrSuccess) && !State->bCancelled;
+        if (State->bSucceeded && State->bBuildsTemplate)
+          MakeGeometryTemplate(*State);
+      }
+      Complete();
+    });
+    return;
+  }
+
+  IAsyncReadFileHandle* FileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(*FullFilePath);
+  if (FileHandle == nullptr) {
+    METAXR_AUDIO_LOG_WARNING("Failed to open audio geometry file: %s", *FullFilePath);
+    PendingLoad.Reset();
+    Complete();
+    return;
+  }
+
+  Load->FullFilePath = FullFilePath;
+  Load->FileHandle.Reset(FileHandle);
+  PendingLoad = Load;
+
+  // The callback is owned by the load state and reaches it by pointer; the reference held by Complete keeps it alive until ReleaseRequests
+  State->SizeCallback = [State, Complete](bool bWasCancelled, IAsyncReadRequest* Request) {
+    const int64 FileSize = bWasCancelled ? 0 : Request->GetSizeResults();
+    if (FileSize <= 0 || State->bCancelled) {
+      Complete();
+      return;
+    }
+
+    // Parsing the mesh is the expensive part; keep it off both the IO thread and the game thread.
+    // The SDK pulls the file through the serializer, so raw files land straight in its own buffers and compressed ones are
+    // inflated a block at a time.
+    Async(EAsyncExecution::ThreadPool, [State, Complete, FileSize]() {
+      FMetaXRAudioAsyncFileSerializer FileSerializer(State->FileHandle.Get(), FileSize, &State->bCancelled);
+      const ovrResult Result =
+          FMetaXRAcousticContainer::ReadGeometry(State->Geometry, FileSerializer.GetSerializer(), &State->Sections, State->SourceHash);
+      State->bSucceeded = (Result == ovrSuccess) && !State->bCancelled;
+      if (State->bSucceeded && State->bBuildsTemplate)
+        MakeGeometryTemplate(*State);
+      Complete();
+    });
+  };
+
+  FScopeLock Lock(&State->RequestCS);
+  State->SizeRequest = FileHandle->SizeRequest(&State->SizeCallback);
+}
+
+void UMetaXRAcousticGeometry::FinishGeometryLoad(const TSharedRef<FAcousticGeometryAsyncLoad>& Load) {
+  PendingLoad.Reset();
+
+  if (Load->bRetry) {
+    LoadGeometryAsync();
+    return;
+  }
+
+  if (!Load->bSucceeded || !CreateGeometrySections(MoveTemp(Load->Sections))) {
+    METAXR_AUDIO_LOG_WARNING("Unable to read audio geometry from file: %s", *Load->FullFilePath);
+    return;
+  } else {
+    METAXR_AUDIO_LOG("Successfully read audio geometry from file: %s", *Load->FullFilePath);
+  }
+
+  SetGeometryEnabled(IsActive());
+  ApplyTransform();
+  ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(OvrGeometry, ovrAudioObjectFlag_Static, IsStatic());
+  if (Levels.IsValid()) {
+    UpdateActiveLevel();
+    SetComponentTickEnabled(true);
+  }
+
+#if WITH_EDITOR
+  UpdateGizmoMesh(OvrGeometry);
+#endif
+
+  MarkGeometryReady();
+}
+
+bool UMetaXRAcousticGeometry::CancelGeometryLoad() {
+  if (!PendingLoad.IsValid())
+    return false;
+
+  FAcousticGeometryAsyncLoad& Load = *PendingLoad;
+  Load.bCancelled = true;
+
+  // A load still waiting on another instance's read of a shared file hasn't touched its handle yet, so it is simply abandoned
+  if (Load.bWaitsForTemplate && !Load.bClaimed.exchange(true)) {
+    PendingLoad.Reset();
+    return false;
+  }
+
+  {
+    FScopeLock Lock(&Load.RequestCS);
+    if (Load.SizeRequest != nullptr)
+      Load.SizeRequest->Cancel();
+  }
+
+  // A parse may already be in flight on a worker, and the SDK can't interrupt it. Rather than waiting on the game thread, the
+  // load takes the handle over and destroys it on its completion.
+  AbandonedLoads.Add(PendingLoad.ToSharedRef());
+  PendingLoad.Reset();
+  return true;
+}
+
+void UMetaXRAcousticGeometry::FlushAbandonedWork() {
+  for (const TSharedRef<FAcousticGeometryAsyncUpload>& Upload : AbandonedUploads) {
+    Upload->DoneEvent->Wait();
+    Upload->Release();
+  }
+  AbandonedUploads.Empty();
+
+  for (const TSharedRef<FAcousticGeometryAsyncLoad>& Load : AbandonedLoads) {
+    Load->DoneEvent->Wait();
+    Load->ReleaseRequests();
+    Load->DestroyGeometry();
+  }
+  AbandonedLoads.Empty();
+
+  for (const TSharedRef<FAcousticGeometryPrewarm>& Prewarm : PendingPrewarms) {
+    Prewarm->DoneEvent->Wait();
+    Prewarm->DestroyGeometries();
+  }
+  PendingPrewarms.Empty();
+}
+
+bool UMetaXRAcousticGeometry::CreateInstanceGeometries(TArray<FMetaXRAcousticPrototype>&& Prototypes) {
+  DestroyInstanceGeometries();
+  if (Prototypes.IsEmpty())
+    return true;
+
+  const TSharedRef<FAcousticGeometryInstances> NewInstances = MakeShared<FAcousticGeometryInstances>();
+  Instances = NewInstances;
+  for (const FMetaXRAcousticPrototype& Prototype : Prototypes) {
+    for (const FMatrix44f& Transform : Prototype.Transforms) {
+      ovrAudioGeometry Geometry = nullptr;
+      if (OVRA_CALL(ovrAudio_CreateAudioGeometry)(CachedContext, &Geometry) != ovrSuccess) {
+        METAXR_AUDIO_LOG_WARNING("Failed creating acoustic geometry for an instance.");
+        return false;
+      }
+      NewInstances->Geometries.Add({Geometry, FMatrix(Transform)});
+
+      // Parsing the already simplified data is cheap compared to simplifying every instance
+      FMetaXRAudioMemorySerializer MemorySerializer(Prototype.MeshData.GetData(), Prototype.MeshData.Num());
+      const ovrAudioSerializer Serializer = MemorySerializer.GetSerializer();
+      if (OVRA_CALL(ovrAudio_AudioGeometryReadMeshData)(Geometry, &Serializer) != ovrSuccess) {
+        METAXR_AUDIO_LOG_WARNING("Unable to read instanced prototype geometry");
+        return false;
+      }
+
+      OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(Geometry, ovrAudioObjectFlag_Enabled, IsActive());
+      OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(Geometry, ovrAudioObjectFlag_Static, IsStatic());
+    }
+  }
+  NewInstances->Prototypes = MoveTemp(Prototypes);
+
+  METAXR_AUDIO_LOG(
+      "Placed %i instances from %i prototypes for geometry %p",
+      NewInstances->Geometries.Num(),
+      NewInstances->Prototypes.Num(),
+      OvrGeometry);
+  return true;
+}
+
+void UMetaXRAcousticGeometry::DestroyInstanceGeometries() {
+  if (!Instances.IsValid())
+    return;
+
+  for (const FAcousticGeometryInstances::FInstance& Instance : Instances->Geometries) {
+    if (OVRA_CALL(ovrAudio_DestroyAudioGeometry)(Instance.Geometry) != ovrSuccess)
+      METAXR_AUDIO_LOG_WARNING("Unable to destroy instance geometry");
+  }
+  Instances.Reset();
+}
+
+void UMetaXRAcousticGeometry::SetInstancesEnabled(bool bEnabled) {
+  if (!Instances.IsValid())
+    return;
+
+  for (const FAcousticGeometryInstances::FInstance& Instance : Instances->Geometries)
+    OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(Instance.Geometry, ovrAudioObjectFlag_Enabled, bEnabled);
+}
+
+// Grows Bounds by the simplified mesh of Geometry, in UE component space
+static bool AppendSimplifiedBounds(ovrAudioGeometry Geometry, FBox3f& Bounds) {
+  uint32_t NumVertices = 0, NumTriangles = 0;
+  ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometryGetSimplifiedMeshWithMaterials)(
+      Geometry, nullptr, &NumVertices, nullptr, nullptr, &NumTriangles);
+  if (Result != ovrSuccess)
+    return false;
+
+  TArray<FVector3f> Vertices;
+  Vertices.SetNum(NumVertices);
+  TArray<uint32> Indices;
+  Indices.SetNum(NumTriangles * 3);
+  TArray<uint32> MaterialIndices;
+  MaterialIndices.SetNum(NumTriangles);
+  Result = OVRA_CALL(ovrAudio_AudioGeometryGetSimplifiedMeshWithMaterials)(
+      Geometry, (float*)Vertices.GetData(), &NumVertices, Indices.GetData(), MaterialIndices.GetData(), &NumTriangles);
+  if (Result != ovrSuccess)
+    return false;
+
+  for (const FVector3f& Vertex : Vertices)
+    Bounds += MetaXRAudioUtilities::ToUEVector3f(Vertex);
+  return true;
+}
+
+// Simplifies the whole geometry once per distant error level. Instances are merged into each level rather than placed from
+// prototypes, so a single handle stands in for everything while the listener is far away.
+bool UMetaXRAcousticGeometry::BuildDistantLevels(FMetaXRAcousticGeometrySections& OutSections) {
+  OutSections.DistantLevels.Reset();
+  OutSections.Bounds = FBox3f(ForceInit);
+  if (DistantErrorLevels.IsEmpty())
+    return true;
+
+  TArray<FMetaXRAcousticErrorLevel> ErrorLevels = DistantErrorLevels;
+  Algo::SortBy(ErrorLevels, &FMetaXRAcousticErrorLevel::Distance);
+  for (const FMetaXRAcousticErrorLevel& ErrorLevel : ErrorLevels) {
+    ovrAudioGeometry Geometry = nullptr;
+    if (OVRA_CALL(ovrAudio_CreateAudioGeometry)(CachedContext, &Geometry) != ovrSuccess) {
+      METAXR_AUDIO_LOG_WARNING("Unable to create temp audio geometry for a distant error level");
+      return false;
+    }
+
+    FMetaXRAcousticDistantLevel Level;
+    Level.Distance = ErrorLevel.Distance;
+    bool bSucceeded = false;
+    {
+      TGuardValue<float> MaxErrorGuard(MaxError, ErrorLevel.MaxError);
+      bSucceeded = UploadMesh(Geometry) && AppendSimplifiedBounds(Geometry, OutSections.Bounds);
+    }
+    if (bSucceeded) {
+      FMetaXRAudioArraySerializer Writer(Level.MeshData);
+      const ovrAudioSerializer Serializer = Writer.GetSerializer();
+      bSucceeded = OVRA_CALL(ovrAudio_AudioGeometryWriteMeshData)(Geometry, &Serializer) == ovrSuccess;
+    }
+
+    if (OVRA_CALL(ovrAudio_DestroyAudioGeometry)(Geometry) != ovrSuccess)
+      METAXR_AUDIO_LOG_WARNING("Failed to destroy temp geometry handle");
+
+    if (!bSucceeded) {
+      METAXR_AUDIO_LOG_WARNING("Failed simplifying distant error level with max error %f", ErrorLevel.MaxError);
+      return false;
+    }
+    OutSections.DistantLevels.Add(MoveTemp(Level));
+  }
+
+  METAXR_AUDIO_LOG("Built %i distant error levels", OutSections.DistantLevels.Num());
+  return true;
+}
+
+bool UMetaXRAcousticGeometry::CreateGeometrySections(FMetaXRAcousticGeometrySections&& Sections) {
+  return CreateInstanceGeometries(MoveTemp(Sections.Prototypes)) && CreateDistantLevels(MoveTemp(Sections));
+}
+
+bool UMetaXRAcousticGeometry::CreateDistantLevels(FMetaXRAcousticGeometrySections&& Sections) {
+  DestroyDistantLevels();
+  if (Sections.DistantLevels.IsEmpty())
+    return true;
+
+  const TSharedRef<FAcousticGeometryLevels> NewLevels = MakeShared<FAcousticGeometryLevels>();
+  Levels = NewLevels;
+  for (const FMetaXRAcousticDistantLevel& Level : Sections.DistantLevels) {
+    ovrAudioGeometry Geometry = nullptr;
+    if (OVRA_CALL(ovrAudio_CreateAudioGeometry)(CachedContext, &Geometry) != ovrSuccess) {
+      METAXR_AUDIO_LOG_WARNING("Failed creating acoustic geometry for a distant error level.");
+      return false;
+    }
+    NewLevels->Geometries.Add(Geometry);
+
+    FMetaXRAudioMemorySerializer MemorySerializer(Level.MeshData.GetData(), Level.MeshData.Num());
+    const ovrAudioSerializer Serializer = MemorySerializer.GetSerializer();
+    if (OVRA_CALL(ovrAudio_AudioGeometryReadMeshData)(Geometry, &Serializer) != ovrSuccess) {
+      METAXR_AUDIO_LOG_WARNING("Unable to read distant error level geometry");
+      return false;
+    }
+
+    // The geometry itself is level 0, so distant levels start out disabled
+    OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(Geometry, ovrAudioObjectFlag_Enabled, false);
+    OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(Geometry, ovrAudioObjectFlag_Static, IsStatic());
+  }
+  NewLevels->Levels = MoveTemp(Sections.DistantLevels);
+  // Without bounds the distance is measured to the component origin
+  NewLevels->Bounds = Sections.Bounds.IsValid ? Sections.Bounds : FBox3f(FVector3f::ZeroVector, FVector3f::ZeroVector);
+
+  METAXR_AUDIO_LOG("Loaded %i distant error levels for geometry %p", NewLevels->Geometries.Num(), OvrGeometry);
+  return true;
+}
+
+void UMetaXRAcousticGeometry::DestroyDistantLevels() {
+  if (!Levels.IsValid())
+    return;
+
+  for (ovrAudioGeometry Geometry : Levels->Geometries) {
+    if (OVRA_CALL(ovrAudio_DestroyAudioGeometry)(Geometry) != ovrSuccess)
+      METAXR_AUDIO_LOG_WARNING("Unable to destroy distant error level geometry");
+  }
+  Levels.Reset();
+}
+
+// Picks the error level for the current listener distance. A level is switched to as soon as the listener is beyond its
+// distance, but only switched away from once the listener is ErrorLevelHysteresis nearer, so a listener standing on a boundary
+// doesn't swap handles every frame.
+void UMetaXRAcousticGeometry::UpdateActiveLevel() {
+  if (!Levels.IsValid() || !IsActive())
+    return;
+
+  const UWorld* World = GetWorld();
+  const APlayerController* Player = World ? World->GetFirstPlayerController() : nullptr;
+  if (Player == nullptr)
+    return;
+
+  FVector ListenerPosition = FVector::ZeroVector;
+  FVector ListenerFront = FVector::ForwardVector;
+  FVector ListenerRight = FVector::RightVector;
+  Player->GetAudioListenerPosition(ListenerPosition, ListenerFront, ListenerRight);
+  const FBox WorldBounds = FBox(Levels->Bounds).TransformBy(GetComponentTransform());
+  const double Distance = FMath::Sqrt(WorldBounds.ComputeSquaredDistanceToPoint(ListenerPosition));
+
+  int32 ActiveLevel = Levels->ActiveLevel;
+  while (ActiveLevel < Levels->Levels.Num() && Distance >= Levels->Levels[ActiveLevel].Distance)
+    ActiveLevel++;
+  while (ActiveLevel > 0 && Distance < Levels->Levels[ActiveLevel - 1].Distance - ErrorLevelHysteresis)
+    ActiveLevel--;
+  if (ActiveLevel == Levels->ActiveLevel)
+    return;
 
-  if (TotalVertexCount == 0) {
-    METAXR_AUDIO_LOG_ERROR("Unable to upload mesh, vertex count is zero %s", *FilePath);
-    return false;
-  }
+  Levels->ActiveLevel = ActiveLevel;
+  SetGeometryEnabled(true);
+  METAXR_AUDIO_LOG("Switched geometry %p to error level %i", OvrGeometry, ActiveLevel);
+}
+
+// Enables or disables the handles of the active error level. The other levels always stay disabled.
+void UMetaXRAcousticGeometry::SetGeometryEnabled(bool bEnabled) {
+  const int32 ActiveLevel = Levels.IsValid() ? Levels->ActiveLevel : 0;
+  OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(OvrGeometry, ovrAudioObjectFlag_Enabled, bEnabled && ActiveLevel == 0);
+  SetInstancesEnabled(bEnabled && ActiveLevel == 0);
+  SetLandscapeTilesEnabled(bEnabled);
+  if (!Levels.IsValid())
+    return;
 
-  METAXR_AUDIO_LOG("Uploading mesh %s with %i vertices", *FilePath, TotalVertexCount);
+  for (int32 LevelIndex = 0; LevelIndex < Levels->Geometries.Num(); ++LevelIndex) {
+    const bool bLevelEnabled = bEnabled && ActiveLevel == LevelIndex + 1;
+    OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(Levels->Geometries[LevelIndex], ovrAudioObjectFlag_Enabled, bLevelEnabled);
+  }
+}
 
+ovrAudioMeshSimplification UMetaXRAcousticGeometry::GetMeshSimplification() const {
   float UnitScale = 0.01f;
   ovrAudioMeshSimplification Simplification{};
   Simplification.thisSize = sizeof(ovrAudioMeshSimplification);
@@ -721,232 +3095,399 @@ bool UMetaXRAcousticGeometry::UploadMesh(
 #if WITH_EDITOR
   Simplification.threadCount = 0; // Use as many threads as CPUs
 #else
-  Simplification.threadCount = 1;
+  Simplification.threadCount = 1; // Runtime uploads run on pool workers, one per geometry
 #endif
+  return Simplification;
+}
 
-  ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometryUploadSimplifiedMeshArrays)(
-      GeometryHandle,
-      Vertices.GetData(),
-      0,
-      Vertices.Num(),
-      0,
-      ovrAudioScalarType_Float64,
-      Indices.GetData(),
-      0,
-      Indices.Num(),
-      ovrAudioScalarType_UInt32,
-      MeshGroups.GetData(),
-      MeshGroups.Num(),
-      &Simplification);
-  if (Result != ovrSuccess) {
-    METAXR_AUDIO_LOG_WARNING("Failed adding geometry to the audio propagation sub-system!");
-    return false;
-  } else {
-    METAXR_AUDIO_LOG("Successfully uploaded geometry %p", GeometryHandle);
+// Geometry from the same source with the same settings is interchangeable between spawns
+FString UMetaXRAcousticGeometry::GetPoolKey() const {
+  FString Key = bFileEnabled ? FilePath : GetPathNameSafe(GetOwner() != nullptr ? GetOwner()->GetClass() : nullptr);
+  Key += FString::Printf(
+      TEXT("|%d|%d|%d|%d|%f|%d|%d|%f|%d|%f|%d|%f|%d|%f|%d|%d|%f"),
+      bIncludeChildren,
+      static_cast<int32>(TraversalMode),
+      static_cast<int32>(GeometrySource),
+      LOD,
+      MaxError,
+      MeshFlags,
+      bCleanMesh,
+      WeldTolerance,
+      bCullInteriorFaces,
+      InteriorCullVoxelSize,
+      bVoxelShell,
+      VoxelShellSize,
+      bUsePhysicalMaterials,
+      GetMinMeshSize(),
+      bSimplifyInstancesOnce,
+      static_cast<int32>(InstanceProxy),
+      InstanceProxyClusterSize);
+
+  // Without a file, spawns of a class only share handles when they hold the same meshes with the same materials in the same
+  // places. The owner's components are hashed as they are rather than gathered, so a spawn pays little for its key. Relative
+  // placements are rounded so the floating point error of where each spawn lands doesn't split the pool.
+  if (!bFileEnabled && GetOwner() != nullptr) {
+    FMD5 Md5;
+    const FTransform GeometryTransform = GetComponentTransform();
+    const TInlineComponentArray<UStaticMeshComponent*> MeshComponents(GetOwner(), bIncludeChildren);
+    for (const UStaticMeshComponent* MeshComponent : MeshComponents) {
+      Key += TEXT("|") + GetPathNameSafe(MeshComponent->GetStaticMesh());
+      for (int32 MaterialIndex = 0; MaterialIndex < MeshComponent->GetNumMaterials(); MaterialIndex++)
+        Key += TEXT(",") + GetPathNameSafe(MeshComponent->GetMaterial(MaterialIndex));
+
+      const FMatrix Placement = MeshComponent->GetComponentTransform().GetRelativeTransform(GeometryTransform).ToMatrixWithScale();
+      int32 Rounded[16];
+      for (int32 Element = 0; Element < 16; Element++)
+        Rounded[Element] = FMath::RoundToInt32(Placement.M[Element / 4][Element % 4] * 100.0);
+      Md5.Update(reinterpret_cast<const uint8*>(Rounded), sizeof(Rounded));
+    }
+    const TInlineComponentArray<UMetaXRAcousticMaterial*> AcousticMaterials(GetOwner(), bIncludeChildren);
+    for (const UMetaXRAcousticMaterial* AcousticMaterial : AcousticMaterials)
+      Key += TEXT("|") + GetPathNameSafe(AcousticMaterial->GetMaterialPreset());
+
+    FMD5Hash PlacementHash;
+    PlacementHash.Set(Md5);
+    Key += TEXT("|") + LexToString(PlacementHash);
   }
+  return FMD5::HashAnsiString(*Key);
+}
 
-  Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(GeometryHandle, ovrAudioObjectFlag_Enabled, true);
-  Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(GeometryHandle, ovrAudioObjectFlag_Static, IsStatic());
+// Instances of a Blueprint keep the file path of their class's template, so they all load the same file
+bool UMetaXRAcousticGeometry::UsesSharedFile() const {
+  const UMetaXRAcousticGeometry* Archetype = Cast<UMetaXRAcousticGeometry>(GetArchetype());
+  return Archetype != nullptr && !Archetype->FilePath.IsEmpty() && Archetype->FilePath == FilePath;
+}
 
+// The file a cooked payload was copied from names it as well as the loose file does. A rebake in the editor changes the file's
+// size or time stamp, so instances started after it don't pick up the template of the old file.
+// The hash of the baked source data tells apart templates of a file patched or rebaked under the same path in cooked builds too.
+// In the editor the file's size and time also catch rebakes of unchanged source data.
+FString UMetaXRAcousticGeometry::GetGeometryCacheKey() const {
+  FString Key = FPaths::ProjectContentDir() / FilePath + TEXT("|") + HierarchyHash;
 #if WITH_EDITOR
-  // Need to remap the gizmo materials after a bake
-  if (GizmoData) {
-    FScopeLock LockGuard(&GizmoUpdateCS);
-    GizmoData->MapGizmoMaterials(Gatherer);
-  }
-  HierarchyHash = ComputeHash();
+  FFileStatData FileStat;
+  if (MetaXRAudioUtilities::GetFileStatData(FilePath, FileStat))
+    Key += FString::Printf(TEXT("|%lld|%lld"), FileStat.FileSize, FileStat.ModificationTime.GetTicks());
 #endif
-
-  // Clean up native handles
-  for (const ovrAudioMeshGroup& Group : MeshGroups) {
-    if (Group.material != nullptr) {
-      Result = OVRA_CALL(ovrAudio_DestroyAudioMaterial)(Group.material);
-      if (Result != ovrSuccess) {
-        METAXR_AUDIO_LOG_WARNING("Failed to destroy material %p", GeometryHandle);
-      }
-    }
-  }
-
-  return (Result == ovrSuccess);
+  return Key;
 }
-#pragma endregion
 
-bool UMetaXRAcousticGeometry::DestroyInternal() {
-  return DestroyPropagationGeometry();
+// Only geometry held entirely in OvrGeometry is recycled, and nothing is pooled while its world tears down
+bool UMetaXRAcousticGeometry::CanReleaseToPool() const {
+  const UWorld* World = GetWorld();
+  if (!bPoolGeometry || !bGeometryReady || World == nullptr || World->bIsTearingDown || !IsPlaymodeActive())
+    return false;
+  return !Instances.IsValid() && !Levels.IsValid() && !LandscapeTiles.IsValid();
 }
 
-bool UMetaXRAcousticGeometry::DestroyPropagationGeometry() {
-  if (OvrGeometry == nullptr)
-    return false;
+int32 UMetaXRAcousticGeometry::PrewarmPool(UWorld* World, int32 Count) {
+  if (!bPoolGeometry)
+    return 0;
 
-  METAXR_AUDIO_LOG("Destroying geometry handle %p", OvrGeometry);
-  ovrResult Result = OVRA_CALL(ovrAudio_DestroyAudioGeometry)(OvrGeometry);
-  if (Result != ovrSuccess)
-    METAXR_AUDIO_LOG_WARNING("Unable to destroy geometry");
+  // Geometry built at startup needs the meshes of a spawned actor, which a template doesn't have
+  if (!bFileEnabled) {
+    METAXR_AUDIO_LOG_WARNING("Only file enabled geometry can be prewarmed, skipping %s", *GetPathName());
+    return 0;
+  }
 
-  OvrGeometry = nullptr;
-  return true;
-}
+  ovrAudioContext Context = nullptr;
+  if (!GetOVRAContext(Context, nullptr, World))
+    return 0;
 
-void UMetaXRAcousticGeometry::TraverseHierarchy(ITransformVisitor& Visitor) const {
-  if (TraversalMode == ETraversalMode::Default || TraversalMode == ETraversalMode::Actor)
-    Visitor.TraverseActorHierarchy(GetOwner());
-  else if (TraversalMode == ETraversalMode::SceneComponent)
-    Visitor.TraverseSceneComponentHierarchy(this);
-  else
-    METAXR_AUDIO_LOG_ERROR("Unknown traversal mode. Cannot traverse hierarchy. Skipping...");
+  const TSharedRef<FAcousticGeometryPrewarm> Prewarm = MakeShared<FAcousticGeometryPrewarm>();
+  Prewarm->Context = Context;
+  Prewarm->PoolKey = GetPoolKey();
+  Prewarm->PoolSize = PoolSize;
+  Prewarm->FullFilePath = FPaths::ProjectContentDir() / FilePath;
+  Prewarm->SourceHash = HierarchyHash;
+  Prewarm->CacheKey = GetGeometryCacheKey();
+  if (BakedData != nullptr && BakedData->HasPayload())
+    Prewarm->BakedData.Reset(BakedData);
+
+  const int32 BuildCount = FMath::Min(Count, PoolSize) - FMetaXRAcousticGeometryPool::Get().GetNumIdle(Prewarm->PoolKey);
+  for (int32 Index = 0; Index < BuildCount; Index++) {
+    ovrAudioGeometry Geometry = nullptr;
+    if (OVRA_CALL(ovrAudio_CreateAudioGeometry)(Context, &Geometry) != ovrSuccess) {
+      METAXR_AUDIO_LOG_WARNING("Failed creating acoustic geometry object.");
+      break;
+    }
+    Prewarm->Geometries.Add(Geometry);
+  }
+  if (Prewarm->Geometries.IsEmpty())
+    return 0;
+  Prewarm->Succeeded.Init(false, Prewarm->Geometries.Num());
+  PendingPrewarms.Add(Prewarm);
+
+  // The handles are parsed on workers and released into the pool back on the game thread, so a level doesn't stall its start on
+  // them. The file is shared with the instances loading it, through the geometry cache.
+  const TFunction<void(const FMetaXRAcousticGeometryCache::FTemplatePtr&, bool)> Build =
+      [Prewarm](const FMetaXRAcousticGeometryCache::FTemplatePtr& Template, bool bBuildsTemplate) {
+        Async(EAsyncExecution::ThreadPool, [Prewarm, Template, bBuildsTemplate]() {
+          BuildPrewarmedGeometries(*Prewarm, Template, bBuildsTemplate);
+          Prewarm->DoneEvent->Trigger();
+          AsyncTask(ENamedThreads::GameThread, [Prewarm]() { FinishPrewarm(Prewarm); });
+        });
+      };
+  bool bShouldLoad = false;
+  const FMetaXRAcousticGeometryCache::FTemplatePtr Template = FMetaXRAcousticGeometryCache::Get().Find(
+      Prewarm->CacheKey, [Build](const FMetaXRAcousticGeometryCache::FTemplatePtr& Loaded) { Build(Loaded, false); }, bShouldLoad);
+  if (Template.IsValid() || bShouldLoad)
+    Build(Template, bShouldLoad);
+  return Prewarm->Geometries.Num();
 }
 
-void UMetaXRAcousticGeometry::ApplyTransform() {
-  if (OvrGeometry == nullptr) {
-    METAXR_AUDIO_LOG_ERROR("No ovrGeoemtry for MetaXRAcousticGeometry");
-    return;
+// Reads the (CollisionSizeQuads + 1)^2 heights of a landscape collision component, scaled and relative to the component
+static bool SampleCollisionHeights(ULandscapeHeightfieldCollisionComponent* Component, TArray<float>& OutHeights) {
+  const int32 Length = Component->CollisionSizeQuads + 1;
+  OutHeights.SetNumUninitialized(Length * Length);
+  for (int32 Y = 0; Y < Length; Y++) {
+    for (int32 X = 0; X < Length; X++) {
+      const TOptional<float> Height =
+          Component->GetHeight(X * Component->CollisionScale, Y * Component->CollisionScale, EHeightfieldSource::Complex);
+      if (!Height.IsSet())
+        return false;
+      OutHeights[Y * Length + X] = Height.GetValue();
+    }
   }
+  return true;
+}
 
-  const FTransform& UETransform = GetComponentTransform();
-  float OVRTransform[16];
-  MetaXRAudioUtilities::ConvertUETransformToOVRTransform(UETransform, OVRTransform);
+bool UMetaXRAcousticGeometry::CreateLandscapeTiles(bool bFileHoldsLandscapes) {
+  DestroyLandscapeTiles();
 
-  ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometrySetTransform)(OvrGeometry, OVRTransform);
-  if (Result != ovrSuccess) {
-    METAXR_AUDIO_LOG("Failed at setting new audio propagation mesh transform!");
-    return;
-  } else {
-    METAXR_AUDIO_LOG("Set transform for geometry %p", OvrGeometry);
+  FMeshGatherer Gatherer(false, bUsePhysicalMaterials, bIncludeChildren, LOD);
+  TraverseHierarchy(Gatherer);
+  if (Gatherer.GetTerrains().IsEmpty())
+    return true;
+  if (bFileHoldsLandscapes) {
+    METAXR_AUDIO_LOG_WARNING("%s was baked with its landscapes, rebake it to build them as tiles", *GetReadableName());
+    return true;
   }
 
-  PreviousTransform = UETransform;
-  PreviousGeometry = OvrGeometry;
+  // The heightfields belong to the landscape, which may stream out at any time, so they are copied here on the game thread
+  const TSharedRef<FAcousticGeometryLandscapeBuild> Build = MakeShared<FAcousticGeometryLandscapeBuild>();
+  for (const FLandscapeMaterial& Landscape : Gatherer.GetTerrains()) {
+    for (ULandscapeHeightfieldCollisionComponent* Component : Landscape.Tiles) {
+      FAcousticGeometryLandscapeBuild::FTileMesh& TileMesh = Build->TileMeshes.AddDefaulted_GetRef();
+      TileMesh.ComponentName = Component->GetName();
+      TileMesh.SectionBase = FIntPoint(Component->SectionBaseX, Component->SectionBaseY);
+      TileMesh.CollisionSizeQuads = Component->CollisionSizeQuads;
+      TileMesh.CollisionScale = Component->CollisionScale;
+      TileMesh.Material = Landscape.Materials.IsEmpty() ? nullptr : Landscape.Materials[0];
+      TileMesh.Transform = Component->GetComponentTransform();
+      TileMesh.bSampled = SampleCollisionHeights(Component, TileMesh.Heights);
+    }
+  }
+  PendingLandscapeBuild = Build;
+
+  // The tiles are decimated in parallel on a worker, so a large landscape doesn't hitch the frame it starts on. Completion hops
+  // back to the game thread to upload the tiles.
+  const FTransform GeometryTransform = GetComponentTransform();
+  const float TileMaxError = MaxError;
+  const TWeakObjectPtr<UMetaXRAcousticGeometry> WeakThis(this);
+  Async(EAsyncExecution::ThreadPool, [WeakThis, Build, GeometryTransform, TileMaxError]() {
+    ParallelFor(Build->TileMeshes.Num(), [&Build, &GeometryTransform, TileMaxError](int32 TileIndex) {
+      FAcousticGeometryLandscapeBuild::FTileMesh& TileMesh = Build->TileMeshes[TileIndex];
+      if (Build->bCancelled || !TileMesh.bSampled)
+        return;
+
+      const float CollisionScale = TileMesh.CollisionScale;
+      MetaXRAcousticHeightfield::Decimate(TileMesh.Heights, TileMesh.CollisionSizeQuads, TileMaxError, TileMesh.Vertices, TileMesh.Indices);
+      TileMesh.Heights.Empty();
+
+      // Grid coordinates to geometry space in OVR axes. Heights come back already scaled, like ALandscapeProxy::GetHeightAtLocation.
+      for (FVector3f& Vertex : TileMesh.Vertices) {
+        const FVector GridPosition(Vertex.X * CollisionScale, Vertex.Y * CollisionScale, 0.0);
+        const FVector WorldPosition =
+            TileMesh.Transform.TransformPosition(GridPosition) + TileMesh.Transform.TransformVectorNoScale(FVector(0.0, 0.0, Vertex.Z));
+        Vertex = FVector3f(MetaXRAudioUtilities::ToOVRVector(GeometryTransform.InverseTransformPosition(WorldPosition)));
+      }
+    });
+
+    AsyncTask(ENamedThreads::GameThread, [WeakThis, Build]() {
+      UMetaXRAcousticGeometry* Geometry = WeakThis.Get();
+      if (Geometry != nullptr && Geometry->PendingLandscapeBuild == Build)
+        Geometry->FinishLandscapeTiles(Build);
+      Build->TileMeshes.Empty();
+    });
+  });
+  return true;
 }
 
-bool UMetaXRAcousticGeometry::ReadFile() {
-  if (FilePath.IsEmpty()) {
-    METAXR_AUDIO_LOG_WARNING("No geometry file path provided!");
-    return false;
-  }
+void UMetaXRAcousticGeometry::FinishLandscapeTiles(const TSharedRef<FAcousticGeometryLandscapeBuild>& Build) {
+  PendingLandscapeBuild.Reset();
 
-  if (IsPlaymodeActive()) {
-    LoadGeometryAsync();
-  } else {
-    const FString FullFilePath = FPaths::ProjectContentDir() / FilePath;
-    if (!FPaths::FileExists(FullFilePath)) {
-      METAXR_AUDIO_LOG_WARNING("Audio geometry file not found: %s", *FullFilePath);
-      return false;
+  // The decimation replaces simplification, which would otherwise run per tile on every startup
+  ovrAudioMeshSimplification Simplification = GetMeshSimplification();
+  Simplification.flags = static_cast<ovrAudioMeshFlags>(MeshFlags & ~ovrAudioMeshFlags_enableMeshSimplification);
+
+  const TSharedRef<FAcousticGeometryLandscapeTiles> NewTiles = MakeShared<FAcousticGeometryLandscapeTiles>();
+  LandscapeTiles = NewTiles;
+  FMetaXRAcousticMaterialRefs MaterialRefs(CachedContext);
+  float OVRTransform[16];
+  MetaXRAudioUtilities::ConvertUETransformToOVRTransform(GetComponentTransform(), OVRTransform);
+  bool bSucceeded = true;
+  int32 TriangleCount = 0;
+  for (const FAcousticGeometryLandscapeBuild::FTileMesh& TileMesh : Build->TileMeshes) {
+    if (!TileMesh.bSampled) {
+      METAXR_AUDIO_LOG_WARNING("Landscape collision component %s has no heightfield to build acoustics from", *TileMesh.ComponentName);
+      continue;
+    }
+
+    ovrAudioMaterial OvrMaterial = nullptr;
+    if (!MaterialRefs.Find(TileMesh.Material, OvrMaterial)) {
+      METAXR_AUDIO_LOG_WARNING("Unable to create audio material for landscape!");
+      bSucceeded = false;
+      break;
+    }
+
+    ovrAudioGeometry Geometry = nullptr;
+    if (OVRA_CALL(ovrAudio_CreateAudioGeometry)(CachedContext, &Geometry) != ovrSuccess) {
+      METAXR_AUDIO_LOG_WARNING("Failed creating acoustic geometry for a landscape tile.");
+      bSucceeded = false;
+      break;
     }
+    const FIntPoint SectionBase = TileMesh.SectionBase;
+    NewTiles->Tiles.Add({Geometry, SectionBase});
 
-    // Read the file data into a byte array
-    ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometryReadMeshFile)(OvrGeometry, TCHAR_TO_UTF8(*FullFilePath));
+    ovrAudioMeshGroup MeshGroup{};
+    MeshGroup.indexOffset = 0;
+    MeshGroup.faceCount = TileMesh.Indices.Num() / 3;
+    MeshGroup.faceType = ovrAudioFaceType_Triangles;
+    MeshGroup.material = OvrMaterial;
+    const ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometryUploadSimplifiedMeshArrays)(
+        Geometry,
+        TileMesh.Vertices.GetData(),
+        0,
+        TileMesh.Vertices.Num(),
+        0,
+        ovrAudioScalarType_Float32,
+        TileMesh.Indices.GetData(),
+        0,
+        TileMesh.Indices.Num(),
+        ovrAudioScalarType_UInt32,
+        &MeshGroup,
+        1,
+        &Simplification);
     if (Result != ovrSuccess) {
-      METAXR_AUDIO_LOG_WARNING("Unable to read audio geometry from file: %s", *FullFilePath);
-      return false;
-    } else {
-      METAXR_AUDIO_LOG("Successfully read geometry from file: %s", *FullFilePath);
+      METAXR_AUDIO_LOG_WARNING("Failed adding landscape tile (%i, %i) to the audio propagation sub-system!", SectionBase.X, SectionBase.Y);
+      bSucceeded = false;
+      break;
     }
 
-    Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(OvrGeometry, ovrAudioObjectFlag_Enabled, true);
-    Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(OvrGeometry, ovrAudioObjectFlag_Static, IsStatic());
+    // The tile missed the transforms applied while it was built
+    OVRA_CALL(ovrAudio_AudioGeometrySetTransform)(Geometry, OVRTransform);
+    OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(Geometry, ovrAudioObjectFlag_Enabled, IsActive());
+    OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(Geometry, ovrAudioObjectFlag_Static, IsStatic());
+    TriangleCount += MeshGroup.faceCount;
   }
+  NewTiles->Materials = MaterialRefs.Detach();
 
-#if WITH_EDITOR
-  UpdateGizmoMesh(OvrGeometry);
-#endif
-  return true;
+  if (!bSucceeded) {
+    METAXR_AUDIO_LOG_WARNING("Failed to create the landscape tiles of %s", *GetReadableName());
+    return;
+  }
+  METAXR_AUDIO_LOG(
+      "Built %i landscape tiles with %i triangles for geometry %p", NewTiles->Tiles.Num(), TriangleCount, OvrGeometry);
 }
 
-// See: FMetaXRAcousticGeometryDetails
-bool UMetaXRAcousticGeometry::WriteFile() {
-  // Create a temporary geometry.
-  ovrAudioGeometry tempGeometryHandle;
-  ovrResult Result = OVRA_CALL(ovrAudio_CreateAudioGeometry)(CachedContext, &tempGeometryHandle);
-  if (Result != ovrSuccess) {
-    METAXR_AUDIO_LOG_WARNING("Unable to create temp audio geometry");
-    return false;
-  } else {
-    METAXR_AUDIO_LOG("Created new temporary geometry handle %p", tempGeometryHandle);
+void UMetaXRAcousticGeometry::DestroyLandscapeTiles() {
+  // The worker only touches its own build, which is dropped once it completes
+  if (PendingLandscapeBuild.IsValid()) {
+    PendingLandscapeBuild->bCancelled = true;
+    PendingLandscapeBuild.Reset();
   }
+  if (!LandscapeTiles.IsValid())
+    return;
 
-  // Upload the mesh geometry and then write the result to disk
-  bool Succeeded = false;
-  if (UploadMesh(tempGeometryHandle)) {
-    if (WriteFileInternal(tempGeometryHandle)) {
-      Succeeded = true;
-#if WITH_EDITOR
-      bNeedsRebake = false;
-#endif // WITH_EDITOR
-    }
+  for (const FAcousticGeometryLandscapeTiles::FTile& Tile : LandscapeTiles->Tiles) {
+    if (OVRA_CALL(ovrAudio_DestroyAudioGeometry)(Tile.Geometry) != ovrSuccess)
+      METAXR_AUDIO_LOG_WARNING("Unable to destroy landscape tile geometry");
   }
+  FMetaXRAcousticMaterialRefs::ReleaseAll(LandscapeTiles->Materials);
+  LandscapeTiles.Reset();
+}
 
-  // Destroy the geometry.
-  METAXR_AUDIO_LOG("Destroying temporary geometry handle %p", tempGeometryHandle);
-  if (OVRA_CALL(ovrAudio_DestroyAudioGeometry)(tempGeometryHandle) != ovrSuccess) {
-    METAXR_AUDIO_LOG_WARNING("Failed to destroy temp geometry handle");
-    Succeeded = false;
-  }
+// Tiles switched off through SetLandscapeTileEnabled stay off while the geometry is enabled
+void UMetaXRAcousticGeometry::SetLandscapeTilesEnabled(bool bEnabled) {
+  if (!LandscapeTiles.IsValid())
+    return;
 
-  return Succeeded;
+  for (const FAcousticGeometryLandscapeTiles::FTile& Tile : LandscapeTiles->Tiles)
+    OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(Tile.Geometry, ovrAudioObjectFlag_Enabled, bEnabled && Tile.bEnabled);
 }
 
-bool UMetaXRAcousticGeometry::WriteFileInternal(ovrAudioGeometry GeometryHandle) {
-  // Setup the filepaths for the output file
-#if WITH_EDITOR
-  GenerateFileNameIfEmpty();
-#endif
-  const FString FullFilePath = FPaths::ProjectContentDir() / FilePath;
-#if WITH_EDITOR
-  MetaXRAudioUtilities::CreateMetaXRAcousticContentDirectory(FPaths::GetPath(FilePath));
-#endif
+void UMetaXRAcousticGeometry::SetLandscapeTileEnabled(FIntPoint SectionBase, bool bEnabled) {
+  if (!LandscapeTiles.IsValid())
+    return;
 
-  // Write the mesh to a file
-  ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometryWriteMeshFile)(GeometryHandle, TCHAR_TO_ANSI(*FullFilePath));
-  if (Result != ovrSuccess) {
-    METAXR_AUDIO_LOG_WARNING("Unable to save geometry to file %s", *FullFilePath);
-    return false;
-  } else {
-    METAXR_AUDIO_LOG("Successfully wrote geometry to file: %s", *FullFilePath);
+  for (FAcousticGeometryLandscapeTiles::FTile& Tile : LandscapeTiles->Tiles) {
+    if (Tile.SectionBase != SectionBase)
+      continue;
+    Tile.bEnabled = bEnabled;
+    OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(Tile.Geometry, ovrAudioObjectFlag_Enabled, bEnabled && IsActive());
   }
+}
 
-#if WITH_EDITOR
-  UpdateGizmoMesh(GeometryHandle);
-#endif
+int32 UMetaXRAcousticGeometry::GetLandscapeTileCount() const {
+  return LandscapeTiles.IsValid() ? LandscapeTiles->Tiles.Num() : 0;
+}
 
-  if (!bFileEnabled) {
-    METAXR_AUDIO_LOG_WARNING("File Successfully written but File Enabled is off, turn it on to use file");
-  }
+// Reachability seeds in staging space: the component's own seeds and the level's player starts
+TArray<FVector3f> UMetaXRAcousticGeometry::GetReachabilitySeeds() const {
+  TArray<FVector3f> Seeds;
+  for (const FVector& Seed : ReachabilitySeeds)
+    Seeds.Add(FVector3f(MetaXRAudioUtilities::ToOVRVector(Seed)));
 
-  return true;
+  const UWorld* World = GetWorld();
+  if (World == nullptr)
+    return Seeds;
+
+  const FTransform& Transform = GetComponentTransform();
+  for (TActorIterator<APlayerStart> ActorItr(World); ActorItr; ++ActorItr)
+    Seeds.Add(FVector3f(MetaXRAudioUtilities::ToOVRVector(Transform.InverseTransformPosition(ActorItr->GetActorLocation()))));
+  return Seeds;
 }
 
-void UMetaXRAcousticGeometry::LoadGeometryAsync() {
-  FString FullFilePath = FPaths::ProjectContentDir() / FilePath;
-#if WITH_EDITOR
-  if (!FPaths::FileExists(FullFilePath)) {
-    METAXR_AUDIO_LOG_WARNING("Audio geometry file not found: %s", *FullFilePath);
-    return;
-  }
-#endif
+float UMetaXRAcousticGeometry::GetMinMeshSize() const {
+  const UMetaXRAcousticProjectSettings* Settings = GetDefault<UMetaXRAcousticProjectSettings>();
+  const float Size = bOverrideSignificance ? MinMeshSize : Settings->MinMeshSize;
+  const float ErrorRatio = bOverrideSignificance ? MinMeshSizeErrorRatio : Settings->MinMeshSizeErrorRatio;
+  return FMath::Max(Size, ErrorRatio * MaxError);
+}
 
-  // Read the file data into a byte array
-  TArray<uint8> FileData;
-  if (!FFileHelper::LoadFileToArray(FileData, *FullFilePath)) {
-    METAXR_AUDIO_LOG_WARNING("Failed to load audio geometry file: %s", *FullFilePath);
-    return;
+FMeshUploadOptions UMetaXRAcousticGeometry::GetMeshUploadOptions(bool bAllowPrototypes) const {
+  FMeshUploadOptions Options;
+  Options.InstanceProxy = InstanceProxy;
+  Options.bSimplifyInstancesOnce = bAllowPrototypes && bSimplifyInstancesOnce;
+  Options.bUseSimpleCollision = GeometrySource == EMetaXRAcousticGeometrySource::SimpleCollision;
+  return Options;
+}
+
+UMetaXRAcousticMaterialProperties* UMetaXRAcousticGeometry::GetInstanceProxyMaterial(
+    const TArray<UMetaXRAcousticMaterialProperties*>& MeshMaterials) {
+  if (InstanceProxyMaterial)
+    return InstanceProxyMaterial;
+
+  // Proxies keep the acoustic material of the mesh they stand in for
+  for (UMetaXRAcousticMaterialProperties* Material : MeshMaterials) {
+    if (Material != nullptr)
+      return Material;
   }
 
-  ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometryReadMeshMemory)(OvrGeometry, (const int8_t*)FileData.GetData(), FileData.Num());
-  if (Result != ovrSuccess) {
-    METAXR_AUDIO_LOG_WARNING("Unable to read audio geometry from memory: %s", *FullFilePath);
-    return;
-  } else {
-    METAXR_AUDIO_LOG("Successfully read audio geometry from memory: %s", *FullFilePath);
+  if (!DefaultInstanceProxyMaterial) {
+    DefaultInstanceProxyMaterial = NewObject<UMetaXRAcousticMaterialProperties>(this, NAME_None, RF_Transient);
+    DefaultInstanceProxyMaterial->ApplyPreset(EMetaXRAudioMaterialPreset::Foliage);
   }
+  return DefaultInstanceProxyMaterial;
+}
 
-  Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(OvrGeometry, ovrAudioObjectFlag_Enabled, true);
-  ApplyTransform();
-  Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(OvrGeometry, ovrAudioObjectFlag_Static, IsStatic());
+void UMetaXRAcousticGeometry::MarkGeometryReady() {
+  if (bGeometryReady)
+    return;
 
-#if WITH_EDITOR
-  UpdateGizmoMesh(OvrGeometry);
-#endif
+  bGeometryReady = true;
+  OnGeometryReady.Broadcast(this);
 }
 
 void UMetaXRAcousticGeometry::PostLoad() {
@@ -979,24 +3520,26 @@ void UMetaXRAcousticGeometry::DestroyComponent(bool bPromoteChildren) {
 void UMetaXRAcousticGeometry::Activate(bool bReset) {
   Super::Activate(bReset);
 
-  if (OvrGeometry == nullptr)
+  // A pending load applies the activation state when it completes
+  if (OvrGeometry == nullptr || PendingLoad.IsValid())
     return;
 
-  ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(OvrGeometry, ovrAudioObjectFlag_Enabled, true);
+  SetGeometryEnabled(true);
   ApplyTransform();
-  Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(OvrGeometry, ovrAudioObjectFlag_Static, IsStatic());
+  ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(OvrGeometry, ovrAudioObjectFlag_Static, IsStatic());
   METAXR_AUDIO_LOG("Set transform and activated for geometry %p", OvrGeometry);
 }
 
 void UMetaXRAcousticGeometry::Deactivate() {
   Super::Deactivate();
 
-  if (OvrGeometry == nullptr)
+  // A pending load applies the activation state when it completes
+  if (OvrGeometry == nullptr || PendingLoad.IsValid())
     return;
 
-  ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(OvrGeometry, ovrAudioObjectFlag_Enabled, false);
+  SetGeometryEnabled(false);
   ApplyTransform();
-  Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(OvrGeometry, ovrAudioObjectFlag_Static, IsStatic());
+  ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(OvrGeometry, ovrAudioObjectFlag_Static, IsStatic());
   METAXR_AUDIO_LOG("Set transform and deactivated for geometry %p", OvrGeometry);
 }
 
@@ -1036,6 +3579,12 @@ void UMetaXRAcousticGeometry::PostEditChangeProperty(struct FPropertyChangedEven
   Super::PostEditChangeProperty(PropertyChangedEvent);
 }
 
+void UMetaXRAcousticGeometry::PreSave(FObjectPreSaveContext ObjectSaveContext) {
+  Super::PreSave(ObjectSaveContext);
+  if (bFileEnabled)
+    UMetaXRAcousticBakedData::AttachForCook(this, FilePath, BakedData, ObjectSaveContext);
+}
+
 FPrimitiveSceneProxy* UMetaXRAcousticGeometry::CreateSceneProxy() {
 #if WITH_EDITOR_GIZMOS
   return new FMetaXRAcousticGeometrySceneProxy(this);
@@ -1056,8 +3605,9 @@ FBoxSphereBounds UMetaXRAcousticGeometry::CalcBounds(const FTransform& LocalToWo
 
   // Collect all the meshes and landscapes associated with this geometry.
   // Always traverse actor hierarchy for bounds.
-  FMeshGatherer Gatherer = FMeshGatherer(false, bUsePhysicalMaterials, bIncludeChildren, LOD);
+  FMeshGatherer Gatherer = FMeshGatherer(false, bUsePhysicalMaterials, bIncludeChildren, LOD, GetMinMeshSize());
   Gatherer.TraverseActorHierarchy(GetOwner());
+  GatherChunkMeshes(Gatherer);
 
   // Update the counts for all static meshes
   for (const AcousticMesh& MeshData : Gatherer.GetMeshes()) {
@@ -1067,15 +3617,72 @@ FBoxSphereBounds UMetaXRAcousticGeometry::CalcBounds(const FTransform& LocalToWo
 
   // Update the counts for all landscapes
   for (const FLandscapeMaterial& LandscapeMaterial : Gatherer.GetTerrains()) {
-    for (auto It = LandscapeMaterial.LandscapeInfo->XYtoComponentMap.CreateIterator(); It; ++It) {
-      const ULandscapeComponent* Component = It.Value();
-      GeometryBounds = GeometryBounds + Component->Bounds.TransformBy(Component->GetComponentTransform());
-    }
+    for (const ULandscapeHeightfieldCollisionComponent* Component : LandscapeMaterial.Tiles)
+      GeometryBounds = GeometryBounds + Component->Bounds;
   }
 
   return GeometryBounds;
 }
 
+// Counts the triangles of an already simplified prototype as the runtime reads it, once per instance
+static bool CountPrototypeTriangles(ovrAudioContext Context, const FMetaXRAcousticPrototype& Prototype, int64& OutTriangleCount) {
+  OutTriangleCount = 0;
+  ovrAudioGeometry Geometry = nullptr;
+  if (OVRA_CALL(ovrAudio_CreateAudioGeometry)(Context, &Geometry) != ovrSuccess)
+    return false;
+
+  FMetaXRAudioMemorySerializer MemorySerializer(Prototype.MeshData.GetData(), Prototype.MeshData.Num());
+  const ovrAudioSerializer Serializer = MemorySerializer.GetSerializer();
+  uint32_t NumVertices = 0, NumTriangles = 0;
+  const bool bSucceeded = OVRA_CALL(ovrAudio_AudioGeometryReadMeshData)(Geometry, &Serializer) == ovrSuccess &&
+      OVRA_CALL(ovrAudio_AudioGeometryGetSimplifiedMeshWithMaterials)(
+          Geometry, nullptr, &NumVertices, nullptr, nullptr, &NumTriangles) == ovrSuccess;
+
+  if (OVRA_CALL(ovrAudio_DestroyAudioGeometry)(Geometry) != ovrSuccess)
+    METAXR_AUDIO_LOG_WARNING("Failed to destroy temp geometry handle");
+
+  OutTriangleCount = static_cast<int64>(NumTriangles) * Prototype.Transforms.Num();
+  return bSucceeded;
+}
+
+bool UMetaXRAcousticGeometry::CountSimplifiedTriangles(float InMaxError, int32& OutTriangleCount) {
+  OutTriangleCount = 0;
+  if (CachedContext == nullptr && !GetOVRAContext(CachedContext, GetOwner(), GetWorld()))
+    return false;
+
+  ovrAudioGeometry Geometry = nullptr;
+  if (OVRA_CALL(ovrAudio_CreateAudioGeometry)(CachedContext, &Geometry) != ovrSuccess) {
+    METAXR_AUDIO_LOG_WARNING("Unable to create temp audio geometry");
+    return false;
+  }
+
+  // Staged the way WriteFile bakes it, so instanced meshes simplified once are counted from their prototypes once per instance
+  bool bSucceeded = false;
+  TArray<FMetaXRAcousticPrototype> Prototypes;
+  {
+    TGuardValue<float> MaxErrorGuard(MaxError, InMaxError);
+    bSucceeded = UploadMesh(Geometry, &Prototypes);
+  }
+  uint32_t NumVertices = 0, NumTriangles = 0;
+  if (bSucceeded) {
+    bSucceeded = OVRA_CALL(ovrAudio_AudioGeometryGetSimplifiedMeshWithMaterials)(
+                     Geometry, nullptr, &NumVertices, nullptr, nullptr, &NumTriangles) == ovrSuccess;
+  }
+
+  if (OVRA_CALL(ovrAudio_DestroyAudioGeometry)(Geometry) != ovrSuccess)
+    METAXR_AUDIO_LOG_WARNING("Failed to destroy temp geometry handle");
+
+  int64 TriangleCount = NumTriangles;
+  for (const FMetaXRAcousticPrototype& Prototype : Prototypes) {
+    int64 PrototypeTriangleCount = 0;
+    bSucceeded &= CountPrototypeTriangles(CachedContext, Prototype, PrototypeTriangleCount);
+    TriangleCount += PrototypeTriangleCount;
+  }
+
+  OutTriangleCount = static_cast<int32>(FMath::Min<int64>(TriangleCount, MAX_int32));
+  return bSucceeded;
+}
+
 FMetaXRAcousticGeometrySceneProxy::FMetaXRAcousticGeometrySceneProxy(const UPrimitiveComponent* InComponent)
     : FDebugRenderSceneProxy(InComponent) {
   GeometryComponent = Cast<UMetaXRAcousticGeometry>(InComponent);
@@ -1462,11 +4069,13 @@ UMetaXRAcousticGeometry::FMeshGatherer::FMeshGatherer(
     const bool bIgnoreStatic,
     const bool UsePhysicalMaterials,
     const bool bShouldIncludeChildren,
-    const int LODSelection)
+    const int LODSelection,
+    const float InMinMeshSize)
     : ITransformVisitor(bShouldIncludeChildren),
       bIgnoreStatic(bIgnoreStatic),
       bUsePhysicalMaterials(UsePhysicalMaterials),
-      LodSelection(LODSelection) {}
+      LodSelection(LODSelection),
+      MinMeshSize(InMinMeshSize) {}
 
 TArray<UMetaXRAcousticMaterialProperties*> UMetaXRAcousticGeometry::FMeshGatherer::VisitActor(
     const AActor* CurrentActor,
@@ -1489,7 +4098,7 @@ TArray<UMetaXRAcousticMaterialProperties*> UMetaXRAcousticGeometry::FMeshGathere
     }
 
     const UStaticMesh* Mesh = MeshComponent->GetStaticMesh();
-    if (!Mesh)
+    if (!Mesh || !IsSignificant(MeshComponent))
       continue;
 
     const int32 LodGroupToUse = FMath::Clamp(LodSelection, 0, Mesh->GetRenderData()->LODResources.Num() - 1);
@@ -1513,9 +4122,7 @@ TArray<UMetaXRAcousticMaterialProperties*> UMetaXRAcousticGeometry::FMeshGathere
   }
 
   // Gather the terrains.
-#if WITH_EDITOR
   CollectTerrains(CurrentActor, MaterialsToApply);
-#endif
 
   // Check if there a BSP is used and warn the user we don't support it at this time
   const ABrush* brush = Cast<ABrush>(CurrentActor);
@@ -1551,7 +4158,7 @@ TArray<UMetaXRAcousticMaterialProperties*> UMetaXRAcousticGeometry::FMeshGathere
   }
 
   const UStaticMesh* Mesh = StaticMeshComponent->GetStaticMesh();
-  if (!Mesh)
+  if (!Mesh || !IsSignificant(StaticMeshComponent))
     return MaterialsToApply;
 
   if (NewMaterialCount == 0 && bUsePhysicalMaterials) {
@@ -1567,6 +4174,19 @@ TArray<UMetaXRAcousticMaterialProperties*> UMetaXRAcousticGeometry::FMeshGathere
   return MaterialsToApply;
 }
 
+bool UMetaXRAcousticGeometry::FMeshGatherer::IsSignificant(const UStaticMeshComponent* MeshComponent) {
+  if (MinMeshSize <= 0.0f)
+    return true;
+
+  // The bounds of a single copy of the mesh, so instanced components are judged by what they place rather than the area they cover
+  const FBox Bounds = MeshComponent->GetStaticMesh()->GetBounds().GetBox().TransformBy(MeshComponent->GetComponentTransform());
+  if (Bounds.GetSize().GetMax() >= MinMeshSize)
+    return true;
+
+  ++SkippedMeshCount;
+  return false;
+}
+
 void UMetaXRAcousticGeometry::FMeshGatherer::CollectTerrains(
     const AActor* Actor,
     const TArray<UMetaXRAcousticMaterialProperties*>& MaterialsToApply) {
@@ -1581,12 +4201,19 @@ void UMetaXRAcousticGeometry::FMeshGatherer::CollectTerrains(
   if (LandscapesCachedUWorldPtr == nullptr)
     return;
 
-  ULandscapeInfo* LandscapeInfo = LandscapeActor->GetLandscapeInfo();
-  if (!LandscapeInfo)
+  // Collision components live on the landscape and on each of its streaming proxies
+  UMetaXRAcousticGeometry::FLandscapeMaterial LandscapeMat;
+  for (TActorIterator<ALandscapeProxy> ProxyItr(const_cast<UWorld*>(LandscapesCachedUWorldPtr)); ProxyItr; ++ProxyItr) {
+    if (ProxyItr->GetLandscapeGuid() != LandscapeActor->GetLandscapeGuid())
+      continue;
+    for (ULandscapeHeightfieldCollisionComponent* Component : ProxyItr->CollisionComponents) {
+      if (Component != nullptr)
+        LandscapeMat.Tiles.Add(Component);
+    }
+  }
+  if (LandscapeMat.Tiles.IsEmpty())
     return;
 
-  UMetaXRAcousticGeometry::FLandscapeMaterial LandscapeMat;
-  LandscapeMat.LandscapeInfo = LandscapeInfo;
   LandscapeMat.Materials = MaterialsToApply;
   if (LandscapeMat.Materials.Num() == 0) {
     // use the default acoustic mat properties...
@@ -1662,6 +4289,7 @@ TArray<UMetaXRAcousticMaterialProperties*> UMetaXRAcousticGeometry::FAgeChecker:
   }
 
   const ALandscape* LandscapeActor = Cast<ALandscape>(CurrentActor);
+  bHasLandscapes |= LandscapeActor != nullptr;
   AppendNodeHash(Hash, CurrentActor->GetTransform(), bUsePhysicalMaterials, LandscapeActor, MeshComponents, AcousticMaterials);
   return EmptyAcousticMaterialProps;
 }
@@ -1722,12 +4350,14 @@ void UMetaXRAcousticGeometry::InitGizmoData() {
   if (!GizmoData)
     GizmoData = TUniquePtr<FAcousticGeoGizmoData, FAcousticGeoGizmoDataDeleter>(new FAcousticGeoGizmoData, FAcousticGeoGizmoDataDeleter());
 
-  auto MeshGatherer = FMeshGatherer(false, bUsePhysicalMaterials, bIncludeChildren, LOD);
+  auto MeshGatherer = FMeshGatherer(false, bUsePhysicalMaterials, bIncludeChildren, LOD, GetMinMeshSize());
   TraverseHierarchy(MeshGatherer);
+  GatherChunkMeshes(MeshGatherer);
   {
     FScopeLock LockGuard(&GizmoUpdateCS);
-    GizmoData->MapGizmoMaterials(MeshGatherer);
-    GizmoData->UpdateGizmoMeshData(OvrGeometry);
+    GizmoData->MapGizmoMaterials(
+        MeshGatherer, GetMeshUploadOptions(true), [this](const AcousticMesh& Mesh) { return GetInstanceProxyMaterial(Mesh.Materials); });
+    GizmoData->UpdateGizmoMeshData(OvrGeometry, bMeshSpaceUpload);
   }
   MarkRenderTransformDirty();
 }
@@ -1737,7 +4367,7 @@ void UMetaXRAcousticGeometry::UpdateGizmoMesh(ovrAudioGeometry GeometryHandle) {
     return;
   {
     FScopeLock LockGuard(&GizmoUpdateCS);
-    GizmoData->UpdateGizmoMeshData(GeometryHandle);
+    GizmoData->UpdateGizmoMeshData(GeometryHandle, bMeshSpaceUpload && GeometryHandle == OvrGeometry);
   }
   // While in Editor and Play Mode this is required to render some gizmos.
   // When AActor with UMetaXRAcousticGeometry does not have a static mesh,
@@ -1771,7 +4401,7 @@ bool UMetaXRAcousticGeometry::GetGizmoVertexPositions(TArray<FVector>& GizmoVert
   return true;
 }
 
-void FAcousticGeoGizmoData::UpdateGizmoMeshData(ovrAudioGeometry GeometryHandle) {
+void FAcousticGeoGizmoData::UpdateGizmoMeshData(ovrAudioGeometry GeometryHandle, bool bMeshSpace) {
   if (GeometryHandle == nullptr) {
     METAXR_AUDIO_LOG_WARNING("Unable to update gizmo: Geometry not loaded.");
     return;
@@ -1800,7 +4430,7 @@ void FAcousticGeoGizmoData::UpdateGizmoMeshData(ovrAudioGeometry GeometryHandle)
     METAXR_AUDIO_LOG_WARNING("Failed getting simplified mesh from the audio propagation sub-system!");
   } else {
     for (size_t i = 0; i < NumVertices; i++)
-      GizmoVertices[i] = FDynamicMeshVertex(MetaXRAudioUtilities::ToUEVector3f(VertexArray[i]));
+      GizmoVertices[i] = FDynamicMeshVertex(bMeshSpace ? VertexArray[i] : MetaXRAudioUtilities::ToUEVector3f(VertexArray[i]));
   }
 
   // Create separate index arrays for each material so they can be uniquely colored
@@ -1822,7 +4452,10 @@ void FAcousticGeoGizmoData::UpdateGizmoMeshData(ovrAudioGeometry GeometryHandle)
 }
 
 // Store the materials used so their unique colors can be visualized
-void FAcousticGeoGizmoData::MapGizmoMaterials(UMetaXRAcousticGeometry::FMeshGatherer& Gatherer) {
+void FAcousticGeoGizmoData::MapGizmoMaterials(
+    UMetaXRAcousticGeometry::FMeshGatherer& Gatherer,
+    const FMeshUploadOptions& Options,
+    TFunctionRef<UMetaXRAcousticMaterialProperties*(const AcousticMesh&)> GetProxyMaterial) {
   // Empty any previous mappings
   GizmoMaterialMapping.Empty();
   const int32 LOD = Gatherer.GetLODSelection();
@@ -1855,8 +4488,18 @@ void FAcousticGeoGizmoData::MapGizmoMaterials(UMetaXRAcousticGeometry::FMeshGath
     }
   };
 
-  // Add each mesh's material (or lack of) into the mapping
+  // Add each mesh's material (or lack of) into the mapping. Prototypes live in their own geometries.
+  TArray<UMetaXRAcousticMaterialProperties*> CollisionMaterials;
+  TArray<UMetaXRAcousticMaterialProperties*> ProxyMaterials;
   for (const auto& Mesh : Gatherer.GetMeshes()) {
+    const EMeshUploadPath UploadPath = GetMeshUploadPath(Mesh, Options);
+    if (UploadPath == EMeshUploadPath::Collision)
+      CollisionMaterials.Add(Mesh.Materials.IsEmpty() ? nullptr : Mesh.Materials[0]);
+    if (UploadPath == EMeshUploadPath::Proxy)
+      ProxyMaterials.Add(GetProxyMaterial(Mesh));
+    if (UploadPath != EMeshUploadPath::Merged)
+      continue;
+
     int32 InstanceCount = Mesh.GetInstancedCount();
     do {
       UpdateGizmoMaterialMappingInstance(Mesh);
@@ -1864,8 +4507,8 @@ void FAcousticGeoGizmoData::MapGizmoMaterials(UMetaXRAcousticGeometry::FMeshGath
     } while (InstanceCount > 0);
   }
 
-  for (const auto& Landscape : Gatherer.GetTerrains())
-    GizmoMaterialMapping.Append(Landscape.Materials);
+  GizmoMaterialMapping.Append(CollisionMaterials);
+  GizmoMaterialMapping.Append(ProxyMaterials);
 }
 
 const TArray<FDynamicMeshVertex>& FAcousticGeoGizmoData::GetGizmoVertexData() const {
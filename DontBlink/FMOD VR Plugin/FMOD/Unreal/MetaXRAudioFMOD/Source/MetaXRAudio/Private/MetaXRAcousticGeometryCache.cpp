@@ -0,0 +1,86 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#include "MetaXRAcousticGeometryCache.h"
+#include "Engine/World.h"
+#include "MetaXRAudioLogging.h"
+
+FMetaXRAcousticGeometryCache& FMetaXRAcousticGeometryCache::Get() {
+  static FMetaXRAcousticGeometryCache Cache;
+  return Cache;
+}
+
+void FMetaXRAcousticGeometryCache::Register() {
+  CleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FMetaXRAcousticGeometryCache::OnWorldCleanup);
+}
+
+void FMetaXRAcousticGeometryCache::Unregister() {
+  FWorldDelegates::OnWorldCleanup.Remove(CleanupHandle);
+  Empty();
+}
+
+FMetaXRAcousticGeometryCache::FTemplatePtr
+FMetaXRAcousticGeometryCache::Find(const FString& Key, const FOnLoaded& OnLoaded, bool& bOutShouldLoad) {
+  FScopeLock Lock(&CS);
+  bOutShouldLoad = false;
+  FEntry* Entry = Entries.Find(Key);
+  if (Entry == nullptr) {
+    Entries.Add(Key);
+    bOutShouldLoad = true;
+    return nullptr;
+  }
+
+  if (!Entry->Template.IsValid())
+    Entry->Waiting.Add(OnLoaded);
+  return Entry->Template;
+}
+
+void FMetaXRAcousticGeometryCache::Finish(const FString& Key, const FTemplatePtr& Template) {
+  TArray<FOnLoaded> Waiting;
+  {
+    FScopeLock Lock(&CS);
+    FEntry* Entry = Entries.Find(Key);
+    if (Entry != nullptr) {
+      Waiting = MoveTemp(Entry->Waiting);
+      Entry->Waiting.Reset();
+    }
+
+    if (!Template.IsValid())
+      Entries.Remove(Key);
+    else if (Entry != nullptr)
+      Entry->Template = Template;
+  }
+
+  // Waiters start parses of their own, so they are called outside the lock
+  for (const FOnLoaded& OnLoaded : Waiting)
+    OnLoaded(Template);
+}
+
+int32 FMetaXRAcousticGeometryCache::GetNumTemplates() const {
+  FScopeLock Lock(&CS);
+  int32 Count = 0;
+  for (const TPair<FString, FEntry>& Pair : Entries) {
+    if (Pair.Value.Template.IsValid())
+      Count++;
+  }
+  return Count;
+}
+
+void FMetaXRAcousticGeometryCache::Empty() {
+  int32 DroppedCount = 0;
+  {
+    FScopeLock Lock(&CS);
+    for (auto It = Entries.CreateIterator(); It; ++It) {
+      if (It->Value.Template.IsValid()) {
+        It.RemoveCurrent();
+        DroppedCount++;
+      }
+    }
+  }
+  if (DroppedCount != 0)
+    METAXR_AUDIO_LOG("Dropped %i cached acoustic geometry files", DroppedCount);
+}
+
+void FMetaXRAcousticGeometryCache::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources) {
+  if (World != nullptr && World->IsGameWorld())
+    Empty();
+}
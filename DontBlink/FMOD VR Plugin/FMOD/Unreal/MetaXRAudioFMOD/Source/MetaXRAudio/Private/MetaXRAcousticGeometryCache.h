@@ -0,0 +1,52 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MetaXRAcousticContainer.h"
+
+class UWorld;
+
+// Geometry files shared by every instance of a Blueprint, kept parsed in memory. The first instance to load a shared file reads
+// it as usual and leaves the SDK's uncompressed mesh data and the container sections here; the other instances parse their
+// handles from that copy instead of each reading and inflating the same file. Instances that start while the first read is
+// still in flight wait for it rather than issuing reads of their own.
+class FMetaXRAcousticGeometryCache {
+ public:
+  struct FTemplate {
+    TArray<uint8> MeshData;
+    FMetaXRAcousticGeometrySections Sections;
+  };
+  using FTemplatePtr = TSharedPtr<const FTemplate, ESPMode::ThreadSafe>;
+  // Receives the loaded template, or nullptr when the load failed or was cancelled and the caller must read the file itself.
+  // Called on whichever thread finishes the load.
+  using FOnLoaded = TFunction<void(const FTemplatePtr&)>;
+
+  static FMetaXRAcousticGeometryCache& Get();
+
+  // Empties the cache as game worlds are cleaned up
+  void Register();
+  void Unregister();
+
+  // Returns the template of Key when it is loaded. Otherwise returns nullptr and either queues OnLoaded until the load in flight
+  // finishes, or, when no load is in flight, sets bOutShouldLoad; the caller must then read the file and pass the result to Finish.
+  FTemplatePtr Find(const FString& Key, const FOnLoaded& OnLoaded, bool& bOutShouldLoad);
+  // Keeps Template, or forgets Key when it is nullptr, and hands it to every caller waiting on Key
+  void Finish(const FString& Key, const FTemplatePtr& Template);
+
+  int32 GetNumTemplates() const;
+  // Drops every loaded template. Loads in flight are kept so their callers still get woken.
+  void Empty();
+
+ private:
+  struct FEntry {
+    FTemplatePtr Template;
+    TArray<FOnLoaded> Waiting;
+  };
+
+  void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+  mutable FCriticalSection CS;
+  TMap<FString, FEntry> Entries;
+  FDelegateHandle CleanupHandle;
+};
@@ -0,0 +1,178 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+#include "MetaXRAcousticGeometryChunk.h"
+#include "Components/StaticMeshComponent.h"
+#include "MetaXRAudioLogging.h"
+
+#if WITH_EDITOR
+#include "EngineUtils.h"
+#include "MetaXRAcousticProjectSettings.h"
+#include "MetaXRAudioUtilities.h"
+#endif
+
+static FIntVector GetChunkCell(const FVector& Position, const float ChunkSize) {
+  const FVector CellPosition = Position / ChunkSize;
+  return FIntVector(FMath::FloorToInt32(CellPosition.X), FMath::FloorToInt32(CellPosition.Y), FMath::FloorToInt32(CellPosition.Z));
+}
+
+AMetaXRAcousticGeometryChunk::AMetaXRAcousticGeometryChunk() {
+  Geometry = CreateDefaultSubobject<UMetaXRAcousticGeometry>(TEXT("Geometry"));
+  Geometry->SetMobility(EComponentMobility::Static);
+  RootComponent = Geometry;
+}
+
+void AMetaXRAcousticGeometryChunk::GatherMeshes(TArray<UMetaXRAcousticGeometry::FMeshMaterial>& OutMeshes) const {
+  for (const UMetaXRAcousticGeometry* Source : Sources) {
+    TArray<UMetaXRAcousticGeometry::FMeshMaterial> SourceMeshes;
+    if (Source == nullptr || !Source->GatherChunkableMeshes(SourceMeshes))
+      continue;
+
+    for (UMetaXRAcousticGeometry::FMeshMaterial& Mesh : SourceMeshes) {
+      if (GetChunkCell(Mesh.StaticMesh->Bounds.Origin, ChunkSize) == Cell)
+        OutMeshes.Add(MoveTemp(Mesh));
+    }
+  }
+}
+
+#if WITH_EDITOR
+bool AMetaXRAcousticGeometryChunk::BakeLevel(UWorld* World) {
+  ULevel* Level = World->GetCurrentLevel();
+  const float NewChunkSize = GetDefault<UMetaXRAcousticProjectSettings>()->GeometryChunkSize;
+
+  // Sort the level's static geometry into the cells its meshes are centered in. Moving geometry, geometry built at startup and
+  // landscapes keep their own handles.
+  TMap<FIntVector, TArray<TObjectPtr<UMetaXRAcousticGeometry>>> CellSources;
+  TArray<UMetaXRAcousticGeometry*> ChunkableSources;
+  for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr) {
+    if (ActorItr->GetLevel() != Level || ActorItr->IsA<AMetaXRAcousticGeometryChunk>())
+      continue;
+
+    TInlineComponentArray<UMetaXRAcousticGeometry*> Sources(*ActorItr);
+    for (UMetaXRAcousticGeometry* Source : Sources) {
+      TArray<UMetaXRAcousticGeometry::FMeshMaterial> Meshes;
+      if (!Source->IsFileEnabled() || !Source->IsStatic() || !Source->GatherChunkableMeshes(Meshes) || Meshes.IsEmpty()) {
+        if (Source->bMergedIntoChunk) {
+          Source->Modify();
+          Source->bMergedIntoChunk = false;
+        }
+        continue;
+      }
+
+      ChunkableSources.Add(Source);
+      for (const UMetaXRAcousticGeometry::FMeshMaterial& Mesh : Meshes)
+        CellSources.FindOrAdd(GetChunkCell(Mesh.StaticMesh->Bounds.Origin, NewChunkSize)).AddUnique(Source);
+    }
+  }
+
+  // Reuse one chunk per cell that is still occupied and delete the rest
+  TMap<FIntVector, AMetaXRAcousticGeometryChunk*> Chunks;
+  TArray<AMetaXRAcousticGeometryChunk*> StaleChunks;
+  for (TActorIterator<AMetaXRAcousticGeometryChunk> ChunkItr(World); ChunkItr; ++ChunkItr) {
+    if (ChunkItr->GetLevel() != Level)
+      continue;
+    if (CellSources.Contains(ChunkItr->Cell) && !Chunks.Contains(ChunkItr->Cell))
+      Chunks.Add(ChunkItr->Cell, *ChunkItr);
+    else
+      StaleChunks.Add(*ChunkItr);
+  }
+
+  // Sources of a cell that failed to bake keep their own handles, so they are left out of every other chunk as well
+  TSet<const UMetaXRAcousticGeometry*> FailedSources;
+  const auto FailSources = [&FailedSources](const TArray<TObjectPtr<UMetaXRAcousticGeometry>>& Sources) {
+    for (const UMetaXRAcousticGeometry* Source : Sources)
+      FailedSources.Add(Source);
+  };
+  const auto HasFailed = [&FailedSources](const UMetaXRAcousticGeometry* Source) { return FailedSources.Contains(Source); };
+  TArray<AMetaXRAcousticGeometryChunk*> BakedChunks;
+  for (TPair<FIntVector, TArray<TObjectPtr<UMetaXRAcousticGeometry>>>& CellSource : CellSources) {
+    const FIntVector& ChunkCell = CellSource.Key;
+    const FVector Location = (FVector(ChunkCell) + FVector(0.5)) * NewChunkSize;
+    const FString ChunkName = FString::Printf(TEXT("AcousticGeometryChunk_%d_%d_%d"), ChunkCell.X, ChunkCell.Y, ChunkCell.Z);
+
+    AMetaXRAcousticGeometryChunk*& Chunk = Chunks.FindOrAdd(ChunkCell);
+    if (Chunk == nullptr) {
+      FActorSpawnParameters SpawnParameters;
+      SpawnParameters.OverrideLevel = Level;
+      Chunk = World->SpawnActor<AMetaXRAcousticGeometryChunk>(Location, FRotator::ZeroRotator, SpawnParameters);
+      if (Chunk == nullptr) {
+        METAXR_AUDIO_LOG_WARNING("Unable to spawn acoustic geometry chunk %s", *ChunkName);
+        FailSources(CellSource.Value);
+        continue;
+      }
+    }
+
+    Chunk->Modify();
+    Chunk->Geometry->Modify();
+    Chunk->SetActorLabel(ChunkName);
+    Chunk->SetActorLocation(Location);
+    Chunk->Cell = ChunkCell;
+    Chunk->ChunkSize = NewChunkSize;
+    Chunk->Sources = MoveTemp(CellSource.Value);
+    Chunk->Geometry->FilePath = FString(META_XR_AUDIO_DEFAULT_SAVE_FOLDER) / World->GetMapName() / ChunkName + TEXT(".xrageo");
+    BakedChunks.Add(Chunk);
+  }
+
+  // A failure drops the chunk's sources from the chunks written before it, which are written again without them
+  TArray<AMetaXRAcousticGeometryChunk*> ChunksToWrite = BakedChunks;
+  while (!ChunksToWrite.IsEmpty()) {
+    const int32 NumFailedSources = FailedSources.Num();
+    for (AMetaXRAcousticGeometryChunk* Chunk : ChunksToWrite) {
+      Chunk->Sources.RemoveAll(HasFailed);
+      if (!Chunk->Sources.IsEmpty() && Chunk->Geometry->WriteFile())
+        continue;
+
+      if (!Chunk->Sources.IsEmpty())
+        METAXR_AUDIO_LOG_WARNING("Failed to bake acoustic geometry chunk %s", *Chunk->GetActorLabel());
+      FailSources(Chunk->Sources);
+      BakedChunks.Remove(Chunk);
+      StaleChunks.Add(Chunk);
+    }
+
+    ChunksToWrite.Reset();
+    if (FailedSources.Num() == NumFailedSources)
+      break;
+    for (AMetaXRAcousticGeometryChunk* Chunk : BakedChunks) {
+      if (Chunk->Sources.ContainsByPredicate(HasFailed))
+        ChunksToWrite.Add(Chunk);
+    }
+  }
+  for (AMetaXRAcousticGeometryChunk* Chunk : StaleChunks)
+    World->EditorDestroyActor(Chunk, true);
+
+  // Only sources whose every cell was written are left to their chunks
+  for (UMetaXRAcousticGeometry* Source : ChunkableSources) {
+    const bool bMerged = !HasFailed(Source);
+    if (Source->bMergedIntoChunk != bMerged) {
+      Source->Modify();
+      Source->bMergedIntoChunk = bMerged;
+    }
+  }
+
+  TArray<FString> FilePathsToCheckout;
+  for (const AMetaXRAcousticGeometryChunk* Chunk : BakedChunks)
+    FilePathsToCheckout.Add(FPaths::ProjectContentDir() / Chunk->Geometry->GetFilePath());
+  MetaXRAudioUtilities::CheckOutFilesInSourceControl(FilePathsToCheckout);
+
+  METAXR_AUDIO_LOG_DISPLAY("Baked %i acoustic geometry chunks of %f cm for %s", BakedChunks.Num(), NewChunkSize, *World->GetMapName());
+  return FailedSources.IsEmpty();
+}
+
+void AMetaXRAcousticGeometryChunk::RemoveFromLevel(UWorld* World) {
+  ULevel* Level = World->GetCurrentLevel();
+  TArray<AMetaXRAcousticGeometryChunk*> LevelChunks;
+  for (TActorIterator<AMetaXRAcousticGeometryChunk> ChunkItr(World); ChunkItr; ++ChunkItr) {
+    if (ChunkItr->GetLevel() == Level)
+      LevelChunks.Add(*ChunkItr);
+  }
+
+  for (AMetaXRAcousticGeometryChunk* Chunk : LevelChunks) {
+    for (UMetaXRAcousticGeometry* Source : Chunk->Sources) {
+      if (Source != nullptr && Source->bMergedIntoChunk) {
+        Source->Modify();
+        Source->bMergedIntoChunk = false;
+      }
+    }
+    World->EditorDestroyActor(Chunk, true);
+  }
+  METAXR_AUDIO_LOG_DISPLAY("Removed %i acoustic geometry chunks from %s", LevelChunks.Num(), *World->GetMapName());
+}
+#endif // WITH_EDITOR
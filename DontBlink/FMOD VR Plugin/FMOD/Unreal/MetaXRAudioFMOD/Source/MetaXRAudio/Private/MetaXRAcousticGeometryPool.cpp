@@ -0,0 +1,168 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#include "MetaXRAcousticGeometryPool.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "MetaXRAcousticGeometry.h"
+#include "MetaXRAcousticMaterialPool.h"
+#include "MetaXRAcousticProjectSettings.h"
+#include "MetaXRAudioContext.h"
+#include "MetaXRAudioLogging.h"
+
+// Forward declare hidden function
+ovrResult ovrAudio_AudioGeometrySetObjectFlag(ovrAudioGeometry geometry, ovrAudioObjectFlags flag, int32_t enabled);
+
+FMetaXRAcousticGeometryPool& FMetaXRAcousticGeometryPool::Get() {
+  static FMetaXRAcousticGeometryPool Pool;
+  return Pool;
+}
+
+void FMetaXRAcousticGeometryPool::Register() {
+  PrewarmHandle = FWorldDelegates::OnWorldInitializedActors.AddRaw(this, &FMetaXRAcousticGeometryPool::Prewarm);
+  CleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FMetaXRAcousticGeometryPool::OnWorldCleanup);
+}
+
+void FMetaXRAcousticGeometryPool::Unregister() {
+  FWorldDelegates::OnWorldInitializedActors.Remove(PrewarmHandle);
+  FWorldDelegates::OnWorldCleanup.Remove(CleanupHandle);
+  UMetaXRAcousticGeometry::FlushAbandonedWork();
+  Empty();
+}
+
+ovrAudioGeometry FMetaXRAcousticGeometryPool::Acquire(
+    ovrAudioContext Context,
+    const FString& Key,
+    TArray<ovrAudioMaterial>& OutMaterials,
+    bool& bOutMeshSpaceUpload) {
+  FScopeLock Lock(&CS);
+  TArray<FEntry>* Entries = Idle.Find(Key);
+  if (Entries == nullptr)
+    return nullptr;
+
+  const int32 Index = Entries->FindLastByPredicate([Context](const FEntry& Entry) { return Entry.Context == Context; });
+  if (Index == INDEX_NONE)
+    return nullptr;
+
+  FEntry Entry = MoveTemp((*Entries)[Index]);
+  Entries->RemoveAtSwap(Index);
+  if (Entries->IsEmpty())
+    Idle.Remove(Key);
+
+  OutMaterials = MoveTemp(Entry.Materials);
+  bOutMeshSpaceUpload = Entry.bMeshSpaceUpload;
+  return Entry.Geometry;
+}
+
+bool FMetaXRAcousticGeometryPool::Release(
+    ovrAudioContext Context,
+    const FString& Key,
+    ovrAudioGeometry Geometry,
+    const TArray<ovrAudioMaterial>& Materials,
+    bool bMeshSpaceUpload,
+    int32 MaxIdle) {
+  FScopeLock Lock(&CS);
+  TArray<FEntry>& Entries = Idle.FindOrAdd(Key);
+  if (Entries.Num() >= MaxIdle) {
+    if (Entries.IsEmpty())
+      Idle.Remove(Key);
+    return false;
+  }
+
+  OVRA_CALL(ovrAudio_AudioGeometrySetObjectFlag)(Geometry, ovrAudioObjectFlag_Enabled, false);
+  Entries.Add({Context, Geometry, Materials, bMeshSpaceUpload});
+  return true;
+}
+
+int32 FMetaXRAcousticGeometryPool::GetNumIdle(const FString& Key) const {
+  FScopeLock Lock(&CS);
+  const TArray<FEntry>* Entries = Idle.Find(Key);
+  return Entries != nullptr ? Entries->Num() : 0;
+}
+
+void FMetaXRAcousticGeometryPool::Empty() {
+  TMap<FString, TArray<FEntry>> Entries;
+  {
+    FScopeLock Lock(&CS);
+    Entries = MoveTemp(Idle);
+    Idle.Reset();
+  }
+
+  int32 DestroyedCount = 0;
+  for (const TPair<FString, TArray<FEntry>>& Pair : Entries) {
+    for (const FEntry& Entry : Pair.Value) {
+      if (OVRA_CALL(ovrAudio_DestroyAudioGeometry)(Entry.Geometry) != ovrSuccess)
+        METAXR_AUDIO_LOG_WARNING("Unable to destroy pooled geometry %p", Entry.Geometry);
+      FMetaXRAcousticMaterialRefs::ReleaseAll(Entry.Materials);
+      DestroyedCount++;
+    }
+  }
+  if (DestroyedCount != 0)
+    METAXR_AUDIO_LOG("Destroyed %i pooled geometry handles", DestroyedCount);
+}
+
+// Native components live on the class default object and Blueprint-added ones in the construction scripts of the class chain
+static void GetGeometryTemplates(UClass* ActorClass, TArray<UMetaXRAcousticGeometry*>& OutTemplates) {
+  ActorClass->GetDefaultObject<AActor>()->GetComponents(OutTemplates);
+
+  TArray<const UBlueprintGeneratedClass*> BlueprintClasses;
+  UBlueprintGeneratedClass::GetGeneratedClassesHierarchy(ActorClass, BlueprintClasses);
+  for (const UBlueprintGeneratedClass* BlueprintClass : BlueprintClasses) {
+    if (BlueprintClass->SimpleConstructionScript == nullptr)
+      continue;
+    for (const USCS_Node* Node : BlueprintClass->SimpleConstructionScript->GetAllNodes()) {
+      if (UMetaXRAcousticGeometry* Template = Cast<UMetaXRAcousticGeometry>(Node->ComponentTemplate))
+        OutTemplates.Add(Template);
+    }
+  }
+}
+
+void FMetaXRAcousticGeometryPool::Prewarm(const UWorld::FActorsInitializedParams& Params) {
+  UWorld* World = Params.World;
+  if (World == nullptr || !World->IsGameWorld())
+    return;
+
+  for (const FMetaXRAcousticGeometryPoolPrewarm& Prewarm : GetDefault<UMetaXRAcousticProjectSettings>()->PrewarmedGeometryPools) {
+    if (Prewarm.ActorClass.IsNull())
+      continue;
+    if (UClass* ActorClass = Prewarm.ActorClass.Get()) {
+      PrewarmClass(World, ActorClass, Prewarm.Count);
+      continue;
+    }
+
+    // Classes that aren't loaded yet are prewarmed once they stream in, rather than stalling the level's start on their load
+    const TWeakObjectPtr<UWorld> WeakWorld(World);
+    const TSoftClassPtr<AActor> SoftActorClass = Prewarm.ActorClass;
+    const int32 Count = Prewarm.Count;
+    LoadPackageAsync(
+        SoftActorClass.GetLongPackageName(),
+        FLoadPackageAsyncDelegate::CreateLambda(
+            [this, WeakWorld, SoftActorClass, Count](const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result) {
+              UWorld* LoadedWorld = WeakWorld.Get();
+              if (LoadedWorld == nullptr || LoadedWorld->bIsTearingDown)
+                return;
+              UClass* ActorClass = SoftActorClass.Get();
+              if (ActorClass == nullptr) {
+                METAXR_AUDIO_LOG_WARNING("Unable to load %s to prewarm its acoustic geometry", *SoftActorClass.ToString());
+                return;
+              }
+              PrewarmClass(LoadedWorld, ActorClass, Count);
+            }));
+  }
+}
+
+void FMetaXRAcousticGeometryPool::PrewarmClass(UWorld* World, UClass* ActorClass, int32 Count) {
+  TArray<UMetaXRAcousticGeometry*> Templates;
+  GetGeometryTemplates(ActorClass, Templates);
+  int32 BuiltCount = 0;
+  for (UMetaXRAcousticGeometry* Template : Templates)
+    BuiltCount += Template->PrewarmPool(World, Count);
+  METAXR_AUDIO_LOG("Prewarming %i acoustic geometry handles for %s", BuiltCount, *ActorClass->GetName());
+}
+
+void FMetaXRAcousticGeometryPool::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources) {
+  if (World != nullptr && World->IsGameWorld()) {
+    UMetaXRAcousticGeometry::FlushAbandonedWork();
+    Empty();
+  }
+}
@@ -0,0 +1,55 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+#include "MetaXR_Audio.h"
+#include "MetaXR_Audio_AcousticRayTracing.h"
+
+// Recycles the handles of pooled acoustic geometry between spawns of frequently spawned actors such as projectiles and debris.
+// A despawned geometry leaves its handle, disabled and with its material references, under a key of its source and settings,
+// and the next spawn with the same key takes it over instead of creating and uploading a new one. The actor classes listed in
+// the project's Prewarmed Geometry Pools get their handles built when a level starts.
+class FMetaXRAcousticGeometryPool {
+ public:
+  static FMetaXRAcousticGeometryPool& Get();
+
+  // Prewarms the pools as game worlds start and empties them as worlds are cleaned up
+  void Register();
+  void Unregister();
+
+  // Takes an idle handle of Key in Context along with its material references, or returns nullptr when none is left
+  ovrAudioGeometry Acquire(ovrAudioContext Context, const FString& Key, TArray<ovrAudioMaterial>& OutMaterials, bool& bOutMeshSpaceUpload);
+  // Disables Geometry and keeps it and its material references for the next Acquire of Key. Returns false without taking
+  // anything when MaxIdle handles of Key are already idle.
+  bool Release(
+      ovrAudioContext Context,
+      const FString& Key,
+      ovrAudioGeometry Geometry,
+      const TArray<ovrAudioMaterial>& Materials,
+      bool bMeshSpaceUpload,
+      int32 MaxIdle);
+
+  int32 GetNumIdle(const FString& Key) const;
+  // Destroys every idle handle
+  void Empty();
+
+ private:
+  struct FEntry {
+    ovrAudioContext Context = nullptr;
+    ovrAudioGeometry Geometry = nullptr;
+    TArray<ovrAudioMaterial> Materials;
+    // The handle was uploaded straight from render data and needs its transform applied in mesh space
+    bool bMeshSpaceUpload = false;
+  };
+
+  void Prewarm(const UWorld::FActorsInitializedParams& Params);
+  void PrewarmClass(UWorld* World, UClass* ActorClass, int32 Count);
+  void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+  mutable FCriticalSection CS;
+  TMap<FString, TArray<FEntry>> Idle;
+  FDelegateHandle PrewarmHandle;
+  FDelegateHandle CleanupHandle;
+};
@@ -0,0 +1,133 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#include "MetaXRAcousticHeightfield.h"
+
+namespace {
+struct FRegion {
+  int32 X0, Y0, X1, Y1;
+};
+
+class FHeightGrid {
+ public:
+  FHeightGrid(const TArray<float>& InHeights, int32 InSize) : Heights(InHeights), Stride(InSize + 1) {}
+
+  float Get(int32 X, int32 Y) const {
+    return Heights[Y * Stride + X];
+  }
+
+  // Height of the bilinear surface through the region's corners
+  float Interpolate(const FRegion& Region, float X, float Y) const {
+    const float U = (X - Region.X0) / (Region.X1 - Region.X0);
+    const float V = (Y - Region.Y0) / (Region.Y1 - Region.Y0);
+    const float Bottom = FMath::Lerp(Get(Region.X0, Region.Y0), Get(Region.X1, Region.Y0), U);
+    const float Top = FMath::Lerp(Get(Region.X0, Region.Y1), Get(Region.X1, Region.Y1), U);
+    return FMath::Lerp(Bottom, Top, V);
+  }
+
+  bool IsFlat(const FRegion& Region, float MaxError) const {
+    for (int32 Y = Region.Y0; Y <= Region.Y1; Y++) {
+      for (int32 X = Region.X0; X <= Region.X1; X++) {
+        if (FMath::Abs(Get(X, Y) - Interpolate(Region, X, Y)) > MaxError)
+          return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  const TArray<float>& Heights;
+  const int32 Stride;
+};
+} // namespace
+
+static void SplitRegion(const FHeightGrid& Grid, const FRegion& Region, float MaxError, TArray<FRegion>& OutLeaves) {
+  const int32 Width = Region.X1 - Region.X0;
+  const int32 Height = Region.Y1 - Region.Y0;
+  if ((Width <= 1 && Height <= 1) || Grid.IsFlat(Region, MaxError)) {
+    OutLeaves.Add(Region);
+    return;
+  }
+
+  const int32 MidX = Width > 1 ? Region.X0 + Width / 2 : Region.X1;
+  const int32 MidY = Height > 1 ? Region.Y0 + Height / 2 : Region.Y1;
+  SplitRegion(Grid, {Region.X0, Region.Y0, MidX, MidY}, MaxError, OutLeaves);
+  if (MidX != Region.X1)
+    SplitRegion(Grid, {MidX, Region.Y0, Region.X1, MidY}, MaxError, OutLeaves);
+  if (MidY != Region.Y1)
+    SplitRegion(Grid, {Region.X0, MidY, MidX, Region.Y1}, MaxError, OutLeaves);
+  if (MidX != Region.X1 && MidY != Region.Y1)
+    SplitRegion(Grid, {MidX, MidY, Region.X1, Region.Y1}, MaxError, OutLeaves);
+}
+
+void MetaXRAcousticHeightfield::Decimate(
+    const TArray<float>& Heights,
+    int32 Size,
+    float MaxError,
+    TArray<FVector3f>& OutVertices,
+    TArray<uint32>& OutIndices) {
+  OutVertices.Reset();
+  OutIndices.Reset();
+  const int32 Stride = Size + 1;
+  if (Size < 1 || Heights.Num() < Stride * Stride)
+    return;
+
+  const FHeightGrid Grid(Heights, Size);
+  TArray<FRegion> Leaves;
+  SplitRegion(Grid, {0, 0, Size, Size}, MaxError, Leaves);
+
+  // Every leaf corner and border point is a vertex; leaves walk their whole perimeter so they pick up the corners of smaller
+  // neighbours and no T-junctions are left
+  TArray<bool> Marked;
+  Marked.Init(false, Stride * Stride);
+  for (int32 Index = 0; Index <= Size; Index++) {
+    Marked[Index] = Marked[Size * Stride + Index] = true;
+    Marked[Index * Stride] = Marked[Index * Stride + Size] = true;
+  }
+  for (const FRegion& Leaf : Leaves) {
+    Marked[Leaf.Y0 * Stride + Leaf.X0] = Marked[Leaf.Y0 * Stride + Leaf.X1] = true;
+    Marked[Leaf.Y1 * Stride + Leaf.X0] = Marked[Leaf.Y1 * Stride + Leaf.X1] = true;
+  }
+
+  TArray<uint32> VertexIndices;
+  VertexIndices.Init(MAX_uint32, Stride * Stride);
+  const auto GetVertex = [&](int32 X, int32 Y) {
+    uint32& Vertex = VertexIndices[Y * Stride + X];
+    if (Vertex == MAX_uint32)
+      Vertex = OutVertices.Add(FVector3f(X, Y, Grid.Get(X, Y)));
+    return Vertex;
+  };
+
+  // Perimeters run (X0, Y0) -> (X0, Y1) -> (X1, Y1) -> (X1, Y0), the winding of the quads landscapes were uploaded with
+  TArray<uint32> Perimeter;
+  for (const FRegion& Leaf : Leaves) {
+    Perimeter.Reset();
+    for (int32 Y = Leaf.Y0; Y < Leaf.Y1; Y++) {
+      if (Marked[Y * Stride + Leaf.X0])
+        Perimeter.Add(GetVertex(Leaf.X0, Y));
+    }
+    for (int32 X = Leaf.X0; X < Leaf.X1; X++) {
+      if (Marked[Leaf.Y1 * Stride + X])
+        Perimeter.Add(GetVertex(X, Leaf.Y1));
+    }
+    for (int32 Y = Leaf.Y1; Y > Leaf.Y0; Y--) {
+      if (Marked[Y * Stride + Leaf.X1])
+        Perimeter.Add(GetVertex(Leaf.X1, Y));
+    }
+    for (int32 X = Leaf.X1; X > Leaf.X0; X--) {
+      if (Marked[Leaf.Y0 * Stride + X])
+        Perimeter.Add(GetVertex(X, Leaf.Y0));
+    }
+
+    if (Perimeter.Num() == 4) {
+      OutIndices.Append({Perimeter[0], Perimeter[1], Perimeter[2], Perimeter[0], Perimeter[2], Perimeter[3]});
+      continue;
+    }
+
+    // Fan around the center so every perimeter vertex gets an edge
+    const float CenterX = 0.5f * (Leaf.X0 + Leaf.X1);
+    const float CenterY = 0.5f * (Leaf.Y0 + Leaf.Y1);
+    const uint32 Center = OutVertices.Add(FVector3f(CenterX, CenterY, Grid.Interpolate(Leaf, CenterX, CenterY)));
+    for (int32 Index = 0; Index < Perimeter.Num(); Index++)
+      OutIndices.Append({Center, Perimeter[Index], Perimeter[(Index + 1) % Perimeter.Num()]});
+  }
+}
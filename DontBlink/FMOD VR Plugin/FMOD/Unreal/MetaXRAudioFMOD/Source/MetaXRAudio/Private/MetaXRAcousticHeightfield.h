@@ -0,0 +1,15 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Adaptive triangulation of regular height grids such as landscape collision heightfields. Flat ground is covered by a few large
+// triangles and only rough ground keeps the full grid resolution.
+namespace MetaXRAcousticHeightfield {
+// Triangulates a (Size + 1) x (Size + 1) grid of heights stored row by row. Regions are split in four until the heights inside
+// them are within MaxError of the surface through their corners. Neighbouring regions share every vertex on their common edge,
+// and every vertex on the grid's border is kept, so the result has no cracks inside the grid nor against an adjacent grid.
+// Vertices are output as (column, row, height).
+void Decimate(const TArray<float>& Heights, int32 Size, float MaxError, TArray<FVector3f>& OutVertices, TArray<uint32>& OutIndices);
+} // namespace MetaXRAcousticHeightfield
@@ -0,0 +1,633 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#include "MetaXRAcousticLevelManifest.h"
+#include "Async/Async.h"
+#include "Async/AsyncFileHandle.h"
+#include "Dom/JsonObject.h"
+#include "Engine/LevelStreaming.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "MetaXRAcousticProjectSettings.h"
+#include "MetaXRAudioLogging.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Streaming/LevelStreamingDelegates.h"
+#include "UObject/UObjectGlobals.h"
+#if WITH_EDITOR
+#include "Interfaces/ITargetPlatform.h"
+#include "MetaXRAcousticGeometry.h"
+#include "MetaXRAcousticMap.h"
+#include "Misc/App.h"
+#include "Settings/ProjectPackagingSettings.h"
+#include "UObject/ObjectSaveContext.h"
+#endif
+
+#define UE_ACOUSTIC_MANIFEST_FILE_EXTENSION ".xramanifest"
+#define UE_ACOUSTIC_PACK_FILE_EXTENSION ".xrapack"
+#define UE_ACOUSTIC_MAP_FILE_EXTENSION ".xramap"
+
+// Under the level's package path, so levels of the same name in different folders don't share a manifest
+FString FMetaXRAcousticLevelManifest::GetManifestPath(const FString& LevelPackageName) {
+  return FString(META_XR_AUDIO_DEFAULT_SAVE_FOLDER) / TEXT("Levels") / LevelPackageName + UE_ACOUSTIC_MANIFEST_FILE_EXTENSION;
+}
+
+FString FMetaXRAcousticLevelManifest::GetPackPath(const FString& LevelPackageName) {
+  return FString(META_XR_AUDIO_DEFAULT_SAVE_FOLDER) / TEXT("Levels") / LevelPackageName + UE_ACOUSTIC_PACK_FILE_EXTENSION;
+}
+
+static void SerializePackTable(FArchive& Ar, TArray<FMetaXRAcousticLevelManifest::FFile>& Files) {
+  uint32 Magic = FMetaXRAcousticLevelManifest::PackMagic;
+  uint32 Version = FMetaXRAcousticLevelManifest::PackVersion;
+  int32 Count = Files.Num();
+  Ar << Magic << Version << Count;
+  if (Ar.IsLoading()) {
+    if (Ar.IsError() || Magic != FMetaXRAcousticLevelManifest::PackMagic || Version > FMetaXRAcousticLevelManifest::PackVersion ||
+        Count < 0 || Count > Ar.TotalSize()) {
+      Ar.SetError();
+      return;
+    }
+    Files.SetNum(Count);
+  }
+
+  for (FMetaXRAcousticLevelManifest::FFile& File : Files)
+    Ar << File.Path << File.Size << File.Hash << File.Offset;
+}
+
+bool FMetaXRAcousticLevelManifest::ReadPackTable(FArchive& Ar) {
+  Files.Reset();
+  SerializePackTable(Ar, Files);
+  return !Ar.IsError();
+}
+
+bool FMetaXRAcousticLevelManifest::Read(const FString& LevelPackageName) {
+  Files.Reset();
+  const FString FullFilePath = FPaths::ProjectContentDir() / GetManifestPath(LevelPackageName);
+  FString Json;
+  if (!FPaths::FileExists(FullFilePath) || !FFileHelper::LoadFileToString(Json, *FullFilePath))
+    return false;
+
+  TSharedPtr<FJsonObject> Root;
+  const TArray<TSharedPtr<FJsonValue>>* FileValues = nullptr;
+  if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid() ||
+      !Root->TryGetArrayField(TEXT("Files"), FileValues)) {
+    METAXR_AUDIO_LOG_WARNING("Invalid acoustic level manifest: %s", *FullFilePath);
+    return false;
+  }
+
+  for (const TSharedPtr<FJsonValue>& FileValue : *FileValues) {
+    const TSharedPtr<FJsonObject>* FileObject = nullptr;
+    FFile File;
+    if (!FileValue->TryGetObject(FileObject) || !(*FileObject)->TryGetStringField(TEXT("Path"), File.Path) ||
+        !(*FileObject)->TryGetNumberField(TEXT("Size"), File.Size) || !(*FileObject)->TryGetStringField(TEXT("Hash"), File.Hash)) {
+      METAXR_AUDIO_LOG_WARNING("Invalid file entry in acoustic level manifest: %s", *FullFilePath);
+      continue;
+    }
+    Files.Add(MoveTemp(File));
+  }
+  return true;
+}
+
+#if WITH_EDITOR
+static bool WritePack(FMetaXRAcousticLevelManifest& Manifest, const FString& PackPath) {
+  int64 Offset = 0;
+  for (FMetaXRAcousticLevelManifest::FFile& File : Manifest.Files) {
+    File.Offset = Offset;
+    Offset += File.Size;
+  }
+
+  TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*PackPath));
+  if (!Writer.IsValid()) {
+    METAXR_AUDIO_LOG_WARNING("Unable to create acoustic level pack: %s", *PackPath);
+    return false;
+  }
+
+  SerializePackTable(*Writer, Manifest.Files);
+  TArray<uint8> FileData;
+  for (const FMetaXRAcousticLevelManifest::FFile& File : Manifest.Files) {
+    const FString FullFilePath = FPaths::ProjectContentDir() / File.Path;
+    if (!FFileHelper::LoadFileToArray(FileData, *FullFilePath) || FileData.Num() != File.Size) {
+      METAXR_AUDIO_LOG_WARNING("Unable to pack acoustic file %s into %s", *FullFilePath, *PackPath);
+      Writer.Reset();
+      IFileManager::Get().Delete(*PackPath, false, false, true);
+      return false;
+    }
+    Writer->Serialize(FileData.GetData(), FileData.Num());
+  }
+
+  if (!Writer->Close()) {
+    METAXR_AUDIO_LOG_WARNING("Unable to write acoustic level pack: %s", *PackPath);
+    return false;
+  }
+  return true;
+}
+
+// The platform's cooked Content directory, which is staged with the build. The cook must not write into the project's own.
+static FString GetCookedContentDir(const ITargetPlatform* TargetPlatform) {
+  return FPaths::ProjectSavedDir() / TEXT("Cooked") / TargetPlatform->PlatformName() / FApp::GetProjectName() / TEXT("Content");
+}
+
+bool FMetaXRAcousticLevelManifest::Write(UWorld* World, const ITargetPlatform* TargetPlatform) {
+  // Streamed levels are cooked as worlds of their own, and so are the streaming cells World Partition generates for its actors, so
+  // each of them gets a manifest of its own listing the actors of its persistent level. The prefetch finds it under the package
+  // name of the level being streamed in.
+  const FString LevelPackageName = World->GetOutermost()->GetName();
+  const FString ManifestPath = GetCookedContentDir(TargetPlatform) / GetManifestPath(LevelPackageName);
+  const FString PackPath = GetCookedContentDir(TargetPlatform) / GetPackPath(LevelPackageName);
+  const bool bPack = GetDefault<UMetaXRAcousticProjectSettings>()->bCookLevelPacks;
+
+  // Cooked baked data is stored in the level package, so there are no loose files left to list
+  TArray<FString> Paths;
+  if (!GetDefault<UMetaXRAcousticProjectSettings>()->bCookBakedData) {
+    for (const AActor* Actor : World->PersistentLevel->Actors) {
+      if (Actor == nullptr)
+        continue;
+
+      TInlineComponentArray<UMetaXRAcousticGeometry*> Geometries(Actor);
+      for (const UMetaXRAcousticGeometry* Geometry : Geometries) {
+        if (Geometry->IsFileEnabled() && !Geometry->IsMergedIntoChunk() && Geometry->BakedData == nullptr &&
+            !Geometry->GetFilePath().IsEmpty())
+          Paths.AddUnique(Geometry->GetFilePath());
+      }
+      TInlineComponentArray<UMetaXRAcousticMap*> Maps(Actor);
+      for (const UMetaXRAcousticMap* Map : Maps) {
+        if (Map->BakedData == nullptr && !Map->GetFilePath().IsEmpty())
+          Paths.AddUnique(Map->GetFilePath());
+      }
+    }
+  }
+  // Maps go first, so the map a level's game thread waits for is read from its pack before the geometry loaded on workers
+  Paths.Sort([](const FString& A, const FString& B) {
+    const bool bMapA = A.EndsWith(UE_ACOUSTIC_MAP_FILE_EXTENSION);
+    const bool bMapB = B.EndsWith(UE_ACOUSTIC_MAP_FILE_EXTENSION);
+    return bMapA != bMapB ? bMapA : A < B;
+  });
+
+  FMetaXRAcousticLevelManifest Manifest;
+  for (const FString& Path : Paths) {
+    const FString FullFilePath = FPaths::ProjectContentDir() / Path;
+    const int64 Size = IFileManager::Get().FileSize(*FullFilePath);
+    const FMD5Hash Hash = FMD5Hash::HashFile(*FullFilePath);
+    if (Size <= 0 || !Hash.IsValid()) {
+      METAXR_AUDIO_LOG_WARNING("Acoustic file %s of %s has not been baked", *Path, *LevelPackageName);
+      continue;
+    }
+    Manifest.Files.Add({Path, Size, LexToString(Hash)});
+  }
+
+  // A level must not keep a manifest or pack of an earlier cook that this one doesn't replace
+  IFileManager::Get().Delete(bPack ? *ManifestPath : *PackPath, false, false, true);
+  if (Manifest.Files.IsEmpty()) {
+    IFileManager::Get().Delete(bPack ? *PackPath : *ManifestPath, false, false, true);
+    return true;
+  }
+
+  if (bPack) {
+    if (!WritePack(Manifest, PackPath))
+      return false;
+    METAXR_AUDIO_LOG_DISPLAY("Packed %i acoustic files of %s into %s", Manifest.Files.Num(), *LevelPackageName, *PackPath);
+    return true;
+  }
+
+  TArray<TSharedPtr<FJsonValue>> FileValues;
+  for (const FFile& File : Manifest.Files) {
+    const TSharedRef<FJsonObject> FileObject = MakeShared<FJsonObject>();
+    FileObject->SetStringField(TEXT("Path"), File.Path);
+    FileObject->SetNumberField(TEXT("Size"), static_cast<double>(File.Size));
+    FileObject->SetStringField(TEXT("Hash"), File.Hash);
+    FileValues.Add(MakeShared<FJsonValueObject>(FileObject));
+  }
+  const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+  Root->SetArrayField(TEXT("Files"), FileValues);
+
+  FString Json;
+  if (!FJsonSerializer::Serialize(Root, TJsonWriterFactory<>::Create(&Json)) || !FFileHelper::SaveStringToFile(Json, *ManifestPath)) {
+    METAXR_AUDIO_LOG_WARNING("Unable to write acoustic level manifest: %s", *ManifestPath);
+    return false;
+  }
+
+  METAXR_AUDIO_LOG_DISPLAY("Listed %i acoustic files of %s in %s", Manifest.Files.Num(), *LevelPackageName, *ManifestPath);
+  return true;
+}
+
+// With packs on, the MetaXRAcoustics folder needn't be staged as loose files. The files no level pack holds, those of the geometry and
+// maps of Blueprints and other templates that actors spawned at runtime read, are copied into the cooked Content directory instead.
+static void CopyTemplateFileOnCook(const UObject* Object, const ITargetPlatform* TargetPlatform) {
+  FString Path;
+  if (const UMetaXRAcousticGeometry* Geometry = Cast<UMetaXRAcousticGeometry>(Object)) {
+    if (Geometry->IsFileEnabled())
+      Path = Geometry->GetFilePath();
+  } else if (const UMetaXRAcousticMap* Map = Cast<UMetaXRAcousticMap>(Object)) {
+    Path = Map->GetFilePath();
+  }
+  if (Path.IsEmpty())
+    return;
+
+  const FString FullFilePath = FPaths::ProjectContentDir() / Path;
+  if (IFileManager::Get().Copy(*(GetCookedContentDir(TargetPlatform) / Path), *FullFilePath) != COPY_OK)
+    METAXR_AUDIO_LOG_WARNING("Unable to copy acoustic file %s into the cook of %s", *FullFilePath, *Object->GetPathName());
+}
+
+// The packaging settings are left to the project. Level packs and the template files copied into the cook already hold every file,
+// so with packs on a staged acoustic folder ships each file twice; without packs, loose files are only found when it is staged.
+static void CheckAcousticFolderStaging() {
+  // Once per editor or cook commandlet session, as its first package is saved
+  static bool bChecked = false;
+  if (bChecked)
+    return;
+  bChecked = true;
+
+  const UMetaXRAcousticProjectSettings* Settings = GetDefault<UMetaXRAcousticProjectSettings>();
+  const UProjectPackagingSettings* PackagingSettings = GetDefault<UProjectPackagingSettings>();
+  auto IsAcousticFolder = [](const FDirectoryPath& Directory) {
+    return FPaths::IsSamePath(Directory.Path, TEXT(META_XR_AUDIO_DEFAULT_SAVE_FOLDER));
+  };
+  const bool bStaged = PackagingSettings->DirectoriesToAlwaysStageAsNonUFS.ContainsByPredicate(IsAcousticFolder) ||
+      PackagingSettings->DirectoriesToAlwaysStageAsUFS.ContainsByPredicate(IsAcousticFolder);
+
+  if (Settings->bCookLevelPacks && !Settings->bCookBakedData && bStaged) {
+    METAXR_AUDIO_LOG_WARNING(
+        "Cook Level Packs is on while %s is staged as a non-asset directory, so acoustic files are packaged twice. Remove it from "
+        "Additional Non-Asset Directories to Package.",
+        TEXT(META_XR_AUDIO_DEFAULT_SAVE_FOLDER));
+  } else if (!Settings->bCookLevelPacks && !Settings->bCookBakedData && !bStaged) {
+    METAXR_AUDIO_LOG_WARNING(
+        "%s isn't staged as a non-asset directory, so the cooked game won't find its loose acoustic files. Add it to Additional "
+        "Non-Asset Directories to Package, or turn on Cook Level Packs.",
+        TEXT(META_XR_AUDIO_DEFAULT_SAVE_FOLDER));
+  }
+}
+
+static void WriteManifestOnCook(UObject* Object, FObjectPreSaveContext ObjectSaveContext) {
+  const UMetaXRAcousticProjectSettings* Settings = GetDefault<UMetaXRAcousticProjectSettings>();
+  if (!ObjectSaveContext.IsCooking() || ObjectSaveContext.GetTargetPlatform() == nullptr)
+    return;
+  CheckAcousticFolderStaging();
+  if (!(Settings->bCookLevelManifests || Settings->bCookLevelPacks))
+    return;
+
+  // Without its manifest or pack, a cooked level reads its files one after another, or can't find them at all when packs are on
+  // and the acoustic folder isn't staged
+  UWorld* World = Cast<UWorld>(Object);
+  if (World != nullptr && World->PersistentLevel != nullptr) {
+    if (!FMetaXRAcousticLevelManifest::Write(World, ObjectSaveContext.GetTargetPlatform()))
+      METAXR_AUDIO_LOG_ERROR("Unable to cook the acoustic files of %s", *World->GetOutermost()->GetName());
+  } else if (Settings->bCookLevelPacks && !Settings->bCookBakedData && Object->IsTemplate())
+    CopyTemplateFileOnCook(Object, ObjectSaveContext.GetTargetPlatform());
+}
+#endif // WITH_EDITOR
+
+// Reads the slices of a level's pack on a worker, from front to back through the handle its table was read with, each into a
+// buffer of its own. Files move their slice out once it is read, so the pack only holds what nobody has taken yet.
+class FMetaXRAcousticPackRead {
+ public:
+  FMetaXRAcousticPackRead(
+      const FString& InPackPath,
+      TUniquePtr<FArchive>&& InReader,
+      const TArray<FMetaXRAcousticLevelManifest::FFile>& InFiles)
+      : PackPath(InPackPath), Reader(MoveTemp(InReader)), ContentsOffset(Reader->Tell()), Files(InFiles) {
+    Slices.SetNum(Files.Num());
+    Skipped.Init(false, Files.Num());
+    for (int32 Index = 0; Index < Files.Num(); Index++)
+      SliceEvents.Add(FPlatformProcess::GetSynchEventFromPool(true));
+  }
+  ~FMetaXRAcousticPackRead() {
+    for (FEvent* SliceEvent : SliceEvents)
+      FPlatformProcess::ReturnSynchEventToPool(SliceEvent);
+  }
+
+  static void Start(const TSharedRef<FMetaXRAcousticPackRead, ESPMode::ThreadSafe>& Pack) {
+    Async(EAsyncExecution::ThreadPool, [Pack]() {
+      for (int32 Index = 0; Index < Pack->Files.Num(); Index++) {
+        bool bSkipped = false;
+        {
+          FScopeLock Lock(&Pack->CS);
+          bSkipped = Pack->Skipped[Index];
+        }
+
+        // Once the pack fails to read, the slices left are signalled empty
+        if (!bSkipped && !Pack->Reader->IsError()) {
+          const FMetaXRAcousticLevelManifest::FFile& File = Pack->Files[Index];
+          TArray64<uint8> Slice;
+          Slice.SetNumUninitialized(File.Size);
+          Pack->Reader->Seek(Pack->ContentsOffset + File.Offset);
+          Pack->Reader->Serialize(Slice.GetData(), Slice.Num());
+
+          FScopeLock Lock(&Pack->CS);
+          if (!Pack->Reader->IsError() && !Pack->Skipped[Index])
+            Pack->Slices[Index] = MoveTemp(Slice);
+        }
+        Pack->SliceEvents[Index]->Trigger();
+      }
+      if (Pack->Reader->IsError())
+        METAXR_AUDIO_LOG_WARNING("Unable to read acoustic level pack: %s", *Pack->PackPath);
+      Pack->Reader.Reset();
+    });
+  }
+
+  // Blocks until the slice of file Index is read, then moves it into OutData. Returns false when it couldn't be read.
+  bool TakeSlice(int32 Index, TArray64<uint8>& OutData) {
+    SliceEvents[Index]->Wait();
+    FScopeLock Lock(&CS);
+    OutData = MoveTemp(Slices[Index]);
+    Skipped[Index] = true;
+    return OutData.Num() == Files[Index].Size;
+  }
+
+  // Frees the slice of file Index, or skips its read when the worker hasn't got to it yet
+  void SkipSlice(int32 Index) {
+    FScopeLock Lock(&CS);
+    Skipped[Index] = true;
+    Slices[Index].Empty();
+  }
+
+ private:
+  const FString PackPath;
+  TUniquePtr<FArchive> Reader;
+  // Where the pack's contents start, after its table
+  const int64 ContentsOffset;
+  const TArray<FMetaXRAcousticLevelManifest::FFile> Files;
+  FCriticalSection CS;
+  TArray<TArray64<uint8>> Slices;
+  // Slices taken or no longer wanted, which the worker doesn't read or keep
+  TArray<bool> Skipped;
+  // Triggered as each slice is read, so a file waits for its own slice rather than the whole pack
+  TArray<FEvent*> SliceEvents;
+};
+
+FMetaXRAcousticPrefetchedFile::FMetaXRAcousticPrefetchedFile(
+    const FString& InFullFilePath,
+    const FMetaXRAcousticLevelManifest::FFile& File,
+    const FString& InSourcePath,
+    int64 InSourceOffset)
+    : FullFilePath(InFullFilePath), Hash(File.Hash), Size(File.Size), SourcePath(InSourcePath), SourceOffset(InSourceOffset) {
+  Data.SetNumUninitialized(File.Size);
+}
+
+FMetaXRAcousticPrefetchedFile::FMetaXRAcousticPrefetchedFile(
+    const FString& InFullFilePath,
+    const FMetaXRAcousticLevelManifest::FFile& File,
+    const TSharedRef<FMetaXRAcousticPackRead, ESPMode::ThreadSafe>& InPack,
+    int32 InSliceIndex)
+    : FullFilePath(InFullFilePath), Hash(File.Hash), Size(File.Size), SliceIndex(InSliceIndex), Pack(InPack) {}
+
+FMetaXRAcousticPrefetchedFile::~FMetaXRAcousticPrefetchedFile() {
+  // A slice nobody waited for mustn't stay in the pack until the rest of it is taken
+  if (Pack.IsValid())
+    Pack->SkipSlice(SliceIndex);
+
+  // Requests must be released before the handle that issued them
+  if (Request != nullptr) {
+    Request->WaitCompletion();
+    delete Request;
+  }
+  FileHandle.Reset();
+}
+
+bool FMetaXRAcousticPrefetchedFile::Start() {
+  if (Pack.IsValid())
+    return true;
+
+  FileHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(*SourcePath));
+  if (!FileHandle.IsValid() || Data.IsEmpty())
+    return false;
+
+  // The size is known from the manifest, so the read is issued straight away without a size request first
+  Request = FileHandle->ReadRequest(SourceOffset, Data.Num(), AIOP_Normal, nullptr, Data.GetData());
+  return Request != nullptr;
+}
+
+void FMetaXRAcousticPrefetchedFile::Cancel() {
+  if (Pack.IsValid())
+    Pack->SkipSlice(SliceIndex);
+  if (Request != nullptr)
+    Request->Cancel();
+}
+
+bool FMetaXRAcousticPrefetchedFile::Wait() {
+  if (bWaited)
+    return bSucceeded;
+  bWaited = true;
+
+  if (Pack.IsValid()) {
+    bSucceeded = Pack->TakeSlice(SliceIndex, Data);
+    Pack.Reset();
+  } else if (Request != nullptr) {
+    Request->WaitCompletion();
+    bSucceeded = Request->GetReadResults() != nullptr;
+    delete Request;
+    Request = nullptr;
+    FileHandle.Reset();
+  }
+
+  // A file rebaked or patched after the manifest was written is read again rather than parsed from stale data
+  if (bSucceeded) {
+    FMD5 Md5;
+    Md5.Update(Data.GetData(), Size);
+    FMD5Hash DataHash;
+    DataHash.Set(Md5);
+    bSucceeded = LexToString(DataHash) == Hash;
+    if (!bSucceeded)
+      METAXR_AUDIO_LOG_WARNING("Acoustic file %s doesn't match its level manifest", *FullFilePath);
+  }
+
+  // A slice the pack read didn't provide is retried with a read of its own, since a build with packs has no loose copy of it.
+  // Only once that fails too is the retry left to the loose file.
+  if (!bSucceeded && SliceIndex == INDEX_NONE && SourcePath != FullFilePath)
+    FMetaXRAcousticLevelPrefetch::Get().ForgetPackedFile(FullFilePath);
+  return bSucceeded;
+}
+
+FMetaXRAcousticLevelPrefetch& FMetaXRAcousticLevelPrefetch::Get() {
+  static FMetaXRAcousticLevelPrefetch Prefetch;
+  return Prefetch;
+}
+
+void FMetaXRAcousticLevelPrefetch::Register() {
+#if WITH_EDITOR
+  PreSaveHandle = FCoreUObjectDelegates::OnObjectPreSave.AddStatic(&WriteManifestOnCook);
+#endif
+
+  // Manifests are written by the cook, so only cooked games have any to read
+  if (!FPlatformProperties::RequiresCookedData())
+    return;
+  PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddRaw(this, &FMetaXRAcousticLevelPrefetch::OnPreLoadMap);
+  PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddRaw(this, &FMetaXRAcousticLevelPrefetch::OnPostLoadMap);
+  LevelStreamingHandle =
+      FLevelStreamingDelegates::OnLevelStreamingStateChanged.AddRaw(this, &FMetaXRAcousticLevelPrefetch::OnLevelStreamingStateChanged);
+}
+
+void FMetaXRAcousticLevelPrefetch::Unregister() {
+#if WITH_EDITOR
+  FCoreUObjectDelegates::OnObjectPreSave.Remove(PreSaveHandle);
+#endif
+  FCoreUObjectDelegates::PreLoadMap.Remove(PreLoadMapHandle);
+  FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+  FLevelStreamingDelegates::OnLevelStreamingStateChanged.Remove(LevelStreamingHandle);
+  Empty();
+  FScopeLock Lock(&CS);
+  PackedFiles.Reset();
+}
+
+// A pack is opened once and read from front to back, and its slices are handed out like loose files
+bool FMetaXRAcousticLevelPrefetch::PrefetchPack(const FString& LevelPackageName) {
+  const FString PackPath = FPaths::ProjectContentDir() / FMetaXRAcousticLevelManifest::GetPackPath(LevelPackageName);
+  TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*PackPath, FILEREAD_Silent));
+  if (!Reader.IsValid())
+    return false;
+
+  FMetaXRAcousticLevelManifest Manifest;
+  bool bValid = Manifest.ReadPackTable(*Reader);
+  int64 Size = 0;
+  for (const FMetaXRAcousticLevelManifest::FFile& File : Manifest.Files) {
+    bValid &= File.Offset >= 0 && File.Size > 0;
+    Size = FMath::Max(Size, File.Offset + File.Size);
+  }
+  if (!bValid || Reader->Tell() + Size > Reader->TotalSize()) {
+    METAXR_AUDIO_LOG_WARNING("Invalid acoustic level pack: %s", *PackPath);
+    return false;
+  }
+
+  const int64 ContentsOffset = Reader->Tell();
+  const TSharedRef<FMetaXRAcousticPackRead, ESPMode::ThreadSafe> Pack =
+      MakeShared<FMetaXRAcousticPackRead, ESPMode::ThreadSafe>(PackPath, MoveTemp(Reader), Manifest.Files);
+  {
+    FScopeLock Lock(&CS);
+    TArray<FString>& PrefetchedPaths = LevelFiles.FindOrAdd(LevelPackageName);
+    for (int32 Index = 0; Index < Manifest.Files.Num(); Index++) {
+      const FMetaXRAcousticLevelManifest::FFile& File = Manifest.Files[Index];
+      const FString FullFilePath = FPaths::ProjectContentDir() / File.Path;
+      PackedFiles.Add(FullFilePath, {PackPath, ContentsOffset, File});
+      if (Files.Contains(FullFilePath)) {
+        Pack->SkipSlice(Index);
+        continue;
+      }
+      Files.Add(FullFilePath, MakeShared<FMetaXRAcousticPrefetchedFile, ESPMode::ThreadSafe>(FullFilePath, File, Pack, Index));
+      PrefetchedPaths.Add(FullFilePath);
+    }
+  }
+  FMetaXRAcousticPackRead::Start(Pack);
+  METAXR_AUDIO_LOG("Prefetching %i acoustic files of %s from %s", Manifest.Files.Num(), *LevelPackageName, *PackPath);
+  return true;
+}
+
+void FMetaXRAcousticLevelPrefetch::Prefetch(const FString& LevelPackageName) {
+  if (PrefetchPack(LevelPackageName))
+    return;
+
+  FMetaXRAcousticLevelManifest Manifest;
+  if (!Manifest.Read(LevelPackageName))
+    return;
+
+  int32 StartedCount = 0;
+  FScopeLock Lock(&CS);
+  TArray<FString>& PrefetchedPaths = LevelFiles.FindOrAdd(LevelPackageName);
+  for (const FMetaXRAcousticLevelManifest::FFile& File : Manifest.Files) {
+    const FString FullFilePath = FPaths::ProjectContentDir() / File.Path;
+    if (Files.Contains(FullFilePath))
+      continue;
+
+    const FFileRef Prefetched = MakeShared<FMetaXRAcousticPrefetchedFile, ESPMode::ThreadSafe>(FullFilePath, File, FullFilePath, 0);
+    if (!Prefetched->Start()) {
+      METAXR_AUDIO_LOG_WARNING("Unable to prefetch acoustic file: %s", *FullFilePath);
+      continue;
+    }
+    Files.Add(FullFilePath, Prefetched);
+    PrefetchedPaths.Add(FullFilePath);
+    StartedCount++;
+  }
+  METAXR_AUDIO_LOG("Prefetching %i acoustic files of %s", StartedCount, *LevelPackageName);
+}
+
+FMetaXRAcousticLevelPrefetch::FFileRef FMetaXRAcousticLevelPrefetch::Take(const FString& FullFilePath) {
+  FScopeLock Lock(&CS);
+  FFileRef Prefetched;
+  if (Files.RemoveAndCopyValue(FullFilePath, Prefetched))
+    return Prefetched;
+
+  const FPackedFile* PackedFile = PackedFiles.Find(FullFilePath);
+  if (PackedFile == nullptr)
+    return nullptr;
+
+  const int64 SourceOffset = PackedFile->ContentsOffset + PackedFile->File.Offset;
+  Prefetched =
+      MakeShared<FMetaXRAcousticPrefetchedFile, ESPMode::ThreadSafe>(FullFilePath, PackedFile->File, PackedFile->PackPath, SourceOffset);
+  if (!Prefetched->Start()) {
+    METAXR_AUDIO_LOG_WARNING("Unable to read acoustic file %s from %s", *FullFilePath, *PackedFile->PackPath);
+    return nullptr;
+  }
+  return Prefetched;
+}
+
+void FMetaXRAcousticLevelPrefetch::ForgetPackedFile(const FString& FullFilePath) {
+  FScopeLock Lock(&CS);
+  PackedFiles.Remove(FullFilePath);
+}
+
+void FMetaXRAcousticLevelPrefetch::Drop(const FString& LevelPackageName) {
+  TArray<FFileRef> Untaken;
+  {
+    FScopeLock Lock(&CS);
+    TArray<FString> PrefetchedPaths;
+    LevelFiles.RemoveAndCopyValue(LevelPackageName, PrefetchedPaths);
+    for (const FString& FullFilePath : PrefetchedPaths) {
+      FFileRef Prefetched;
+      if (Files.RemoveAndCopyValue(FullFilePath, Prefetched))
+        Untaken.Add(Prefetched);
+    }
+  }
+
+  for (const FFileRef& Prefetched : Untaken)
+    Prefetched->Cancel();
+  if (!Untaken.IsEmpty())
+    METAXR_AUDIO_LOG("Dropped %i prefetched acoustic files of %s nothing loaded", Untaken.Num(), *LevelPackageName);
+}
+
+void FMetaXRAcousticLevelPrefetch::Empty() {
+  TMap<FString, FFileRef> Untaken;
+  {
+    FScopeLock Lock(&CS);
+    Untaken = MoveTemp(Files);
+    Files.Reset();
+    LevelFiles.Reset();
+  }
+
+  for (const TPair<FString, FFileRef>& Pair : Untaken)
+    Pair.Value->Cancel();
+  if (!Untaken.IsEmpty())
+    METAXR_AUDIO_LOG("Dropped %i prefetched acoustic files nothing loaded", Untaken.Num());
+}
+
+// Opening a map abandons whatever the previous one still had in flight. MapName is the map's package name.
+void FMetaXRAcousticLevelPrefetch::OnPreLoadMap(const FString& MapName) {
+  Empty();
+  Prefetch(MapName);
+}
+
+// Components of the level have begun play by now and taken their files. Levels streaming in alongside keep theirs.
+void FMetaXRAcousticLevelPrefetch::OnPostLoadMap(UWorld* World) {
+  if (World != nullptr)
+    Drop(World->GetOutermost()->GetName());
+}
+
+// A streamed level is prefetched as its package starts loading, and its leftovers dropped once its actors have begun play
+void FMetaXRAcousticLevelPrefetch::OnLevelStreamingStateChanged(
+    UWorld* World,
+    const ULevelStreaming* LevelStreaming,
+    ULevel* LevelIfLoaded,
+    ELevelStreamingState PreviousState,
+    ELevelStreamingState NewState) {
+  if (LevelStreaming == nullptr)
+    return;
+
+  const FString LevelPackageName = LevelStreaming->GetWorldAssetPackageName();
+  if (NewState == ELevelStreamingState::Loading)
+    Prefetch(LevelPackageName);
+  else if (NewState == ELevelStreamingState::LoadedVisible || NewState == ELevelStreamingState::FailedToLoad ||
+           NewState == ELevelStreamingState::Unloaded || NewState == ELevelStreamingState::Removed)
+    Drop(LevelPackageName);
+}
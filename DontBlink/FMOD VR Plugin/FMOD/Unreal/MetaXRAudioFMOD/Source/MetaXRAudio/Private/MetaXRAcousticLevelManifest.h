@@ -0,0 +1,159 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FArchive;
+class FMetaXRAcousticPackRead;
+class IAsyncReadFileHandle;
+class IAsyncReadRequest;
+class ITargetPlatform;
+class ULevel;
+class ULevelStreaming;
+class UWorld;
+enum class ELevelStreamingState : uint8;
+
+// Lists the baked acoustic files (.xrageo and .xramap) a level reads, with their sizes and MD5 hashes. Written into the cooked
+// Content directory when the level is cooked so the files can all be read at once as the level starts loading, rather than one
+// after another as its components begin play. Every level package, persistent or streamed, gets its own, including the streaming
+// cells World Partition generates as the level is cooked. Actors spawned at runtime read their files as they begin play.
+// Optionally the files themselves are packed into one .xrapack per level instead: a table of the files' paths, sizes, hashes
+// and offsets followed by their contents back to back, so the level is read through one handle from front to back.
+struct FMetaXRAcousticLevelManifest {
+  struct FFile {
+    // Relative to the project's Content directory
+    FString Path;
+    int64 Size = 0;
+    FString Hash;
+    // Into the contents of the level's pack, after its table
+    int64 Offset = 0;
+  };
+
+  static constexpr uint32 PackMagic = 0x50415258; // "XRAP"
+  static constexpr uint32 PackVersion = 1;
+
+  TArray<FFile> Files;
+
+  // The manifest and pack of the level package LevelPackageName (e.g. /Game/Maps/Arena), relative to the Content directory
+  static FString GetManifestPath(const FString& LevelPackageName);
+  static FString GetPackPath(const FString& LevelPackageName);
+  bool Read(const FString& LevelPackageName);
+  // Reads the table at the front of a pack, leaving Ar at the start of the contents
+  bool ReadPackTable(FArchive& Ar);
+#if WITH_EDITOR
+  // Lists the loose files of the geometry and maps in World's level, or packs them when "Cook Level Packs" is on, into the
+  // cooked Content directory of TargetPlatform. Files cooked into the level package are left out since they already stream with it.
+  static bool Write(UWorld* World, const ITargetPlatform* TargetPlatform);
+#endif
+};
+
+// A file read issued ahead of the component that needs it: a whole loose file, or a slice of the level's pack
+class FMetaXRAcousticPrefetchedFile {
+ public:
+  // Read with a request of its own from SourcePath at SourceOffset: the loose file itself, or its slice of a pack
+  FMetaXRAcousticPrefetchedFile(
+      const FString& InFullFilePath,
+      const FMetaXRAcousticLevelManifest::FFile& File,
+      const FString& InSourcePath,
+      int64 InSourceOffset);
+  // Read along with the rest of a pack, as the slice of its table entry InSliceIndex
+  FMetaXRAcousticPrefetchedFile(
+      const FString& InFullFilePath,
+      const FMetaXRAcousticLevelManifest::FFile& File,
+      const TSharedRef<FMetaXRAcousticPackRead, ESPMode::ThreadSafe>& InPack,
+      int32 InSliceIndex);
+  ~FMetaXRAcousticPrefetchedFile();
+
+  FMetaXRAcousticPrefetchedFile(const FMetaXRAcousticPrefetchedFile&) = delete;
+  FMetaXRAcousticPrefetchedFile& operator=(const FMetaXRAcousticPrefetchedFile&) = delete;
+
+  // Issues the file's own read. Files read along with their pack have nothing to issue.
+  bool Start();
+  void Cancel();
+  // Blocks until the read is done, taking a packed file's slice out of its pack. Returns false when it failed or the file no longer
+  // matches the manifest, in which case the caller takes the file again: a slice of a pack is then read on its own.
+  bool Wait();
+
+  const FString& GetFullFilePath() const {
+    return FullFilePath;
+  }
+  const uint8* GetData() const {
+    return Data.GetData();
+  }
+  int64 GetSize() const {
+    return Size;
+  }
+
+ private:
+  const FString FullFilePath;
+  const FString Hash;
+  const int64 Size;
+  const FString SourcePath;
+  const int64 SourceOffset = 0;
+  // Entry of the pack's table, for files read along with their pack
+  const int32 SliceIndex = INDEX_NONE;
+  TArray64<uint8> Data;
+  // Released once the slice is taken
+  TSharedPtr<FMetaXRAcousticPackRead, ESPMode::ThreadSafe> Pack;
+  TUniquePtr<IAsyncReadFileHandle> FileHandle;
+  IAsyncReadRequest* Request = nullptr;
+  bool bWaited = false;
+  bool bSucceeded = false;
+};
+
+// Reads the files of a level's manifest in parallel as soon as the level starts loading, for the map as it opens and for each
+// level streamed in after. Geometry and maps take their file from here when they begin play; whatever is left once the level
+// finished loading is dropped.
+class FMetaXRAcousticLevelPrefetch {
+ public:
+  using FFileRef = TSharedPtr<FMetaXRAcousticPrefetchedFile, ESPMode::ThreadSafe>;
+
+  static FMetaXRAcousticLevelPrefetch& Get();
+
+  // Prefetches each map loaded in a cooked game, and in the editor writes the manifest of each level being cooked
+  void Register();
+  void Unregister();
+
+  // Starts reading every file listed in the manifest of the level package LevelPackageName
+  void Prefetch(const FString& LevelPackageName);
+  // Hands the read of FullFilePath over to the caller, or returns nullptr when the file isn't being prefetched. Files of a pack
+  // read earlier that weren't prefetched, such as those of actors spawned later, are read out of the pack.
+  FFileRef Take(const FString& FullFilePath);
+  // Stops reading FullFilePath out of its pack after a read of its slice on its own failed
+  void ForgetPackedFile(const FString& FullFilePath);
+  // Cancels and drops the reads of LevelPackageName nobody took
+  void Drop(const FString& LevelPackageName);
+  // Cancels and drops every read nobody took. Packs stay known.
+  void Empty();
+
+ private:
+  bool PrefetchPack(const FString& LevelPackageName);
+  void OnPreLoadMap(const FString& MapName);
+  void OnPostLoadMap(UWorld* World);
+  void OnLevelStreamingStateChanged(
+      UWorld* World,
+      const ULevelStreaming* LevelStreaming,
+      ULevel* LevelIfLoaded,
+      ELevelStreamingState PreviousState,
+      ELevelStreamingState NewState);
+
+  struct FPackedFile {
+    FString PackPath;
+    // Where the pack's contents start, after its table
+    int64 ContentsOffset = 0;
+    FMetaXRAcousticLevelManifest::FFile File;
+  };
+
+  FCriticalSection CS;
+  TMap<FString, FFileRef> Files;
+  // The files prefetched for each level package, for dropping what the level didn't take
+  TMap<FString, TArray<FString>> LevelFiles;
+  TMap<FString, FPackedFile> PackedFiles;
+#if WITH_EDITOR
+  FDelegateHandle PreSaveHandle;
+#endif
+  FDelegateHandle PreLoadMapHandle;
+  FDelegateHandle PostLoadMapHandle;
+  FDelegateHandle LevelStreamingHandle;
+};
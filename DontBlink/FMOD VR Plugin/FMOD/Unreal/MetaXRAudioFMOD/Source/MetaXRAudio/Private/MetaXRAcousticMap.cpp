@@ -7,7 +7,10 @@
 #include "HAL/PlatformFileManager.h"
 #include "IMetaXRAudioPlugin.h"
 #include "Materials/MaterialInstanceDynamic.h"
+#include "MetaXRAcousticBakedData.h"
+#include "MetaXRAcousticContainer.h"
 #include "MetaXRAcousticGeometry.h"
+#include "MetaXRAcousticLevelManifest.h"
 #include "MetaXRAcousticMaterial.h"
 #include "MetaXRAcousticProjectSettings.h"
 #include "MetaXRAudioContext.h"
@@ -25,6 +28,7 @@
 #if WITH_EDITOR
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Templates/UnrealTypeTraits.h"
+#include "UObject/ObjectSaveContext.h"
 #endif
 
 #define WITH_EDITOR_GIZMOS (WITH_EDITOR && WITH_EDITORONLY_DATA)
@@ -201,6 +205,8 @@ void FAsyncSceneMappingTask::DoWork() {
     METAXR_AUDIO_LOG_WARNING("Unable to save acoustic map to file %s", *FullFilePath);
   } else {
     METAXR_AUDIO_LOG_DISPLAY("Successfully saved acoustic map to file %s", *FullFilePath);
+    if (GetDefault<UMetaXRAcousticProjectSettings>()->bCompressBakedData)
+      FMetaXRAcousticContainer::CompressFile(FullFilePath, AcousticMapComponent->Hash);
   }
 }
 #endif // if WITH_EDITOR
@@ -215,6 +221,22 @@ UMetaXRAcousticMap::UMetaXRAcousticMap() {
 #endif
 }
 
+// The scene IR API only reads from a path or a memory block, so parse straight out of a memory-mapped view when the
+// platform supports it. Only fall back to a heap copy of the whole file otherwise.
+static ovrResult ReadSceneIRFromFile(ovrAudioSceneIR SceneIR, const FString& FullFilePath, const FString& SourceHash) {
+  TUniquePtr<IMappedFileHandle> MappedHandle(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FullFilePath));
+  TUniquePtr<IMappedFileRegion> MappedRegion(MappedHandle.IsValid() ? MappedHandle->MapRegion() : nullptr);
+  if (MappedRegion.IsValid())
+    return FMetaXRAcousticContainer::ReadSceneIR(SceneIR, MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize(), SourceHash);
+
+  TArray<uint8> FileData;
+  if (!FFileHelper::LoadFileToArray(FileData, *FullFilePath)) {
+    METAXR_AUDIO_LOG_WARNING("Failed to load audio acoustic map file: %s", *FullFilePath);
+    return ovrError_AudioInvalidParam;
+  }
+  return FMetaXRAcousticContainer::ReadSceneIR(SceneIR, FileData.GetData(), FileData.Num(), SourceHash);
+}
+
 void UMetaXRAcousticMap::StartInternal(bool AutoLoad) {
   // Ensure that the IR is not initialized twice.
   if (CachedMap != nullptr) {
@@ -252,7 +274,7 @@ void UMetaXRAcousticMap::StartInternal(bool AutoLoad) {
     }
 
     // Do a blocking load from file when not playing so inspector can update immediately
-    if (OVRA_CALL(ovrAudio_AudioSceneIRReadFile)(CachedMap, TCHAR_TO_ANSI(*FullFilePath)) != ovrSuccess) {
+    if (ReadSceneIRFromFile(CachedMap, FullFilePath, SceneHash) != ovrSuccess) {
       METAXR_AUDIO_LOG_WARNING("Unable to create internal Acoustic Map");
       return;
     } else {
@@ -287,6 +309,19 @@ void UMetaXRAcousticMap::DestroyInternal() {
 }
 
 void UMetaXRAcousticMap::LoadData() {
+  // Cooked data was already streamed in with the level package
+  if (BakedData != nullptr && BakedData->HasPayload()) {
+    const bool bRead = BakedData->ReadPayload([this](const uint8* Data, int64 Size) {
+      return FMetaXRAcousticContainer::ReadSceneIR(CachedMap, Data, Size, SceneHash) == ovrSuccess;
+    });
+    if (bRead) {
+      METAXR_AUDIO_LOG("Loaded acoustic map from baked data: %s to %p", *BakedData->GetPathName(), CachedMap);
+      EnableLoadedMap();
+      return;
+    }
+    METAXR_AUDIO_LOG_WARNING("Unable to read acoustic map from baked data %s, falling back to file", *BakedData->GetPathName());
+  }
+
   if (FilePath.IsEmpty()) {
     METAXR_AUDIO_LOG_WARNING("No filepath for MetaXRAcousticMap");
     return;
@@ -300,15 +335,18 @@ void UMetaXRAcousticMap::LoadData() {
   }
 #endif
 
-  // Read the file data into a byte array
-  TArray<uint8> FileData;
-  if (!FFileHelper::LoadFileToArray(FileData, *FullFilePath)) {
-    METAXR_AUDIO_LOG_WARNING("Failed to load audio acoustic map file: %s", *FullFilePath);
+  // The level manifest had the file read as the level started loading. A slice its pack failed to provide is read again on its own.
+  FMetaXRAcousticLevelPrefetch::FFileRef Prefetched = FMetaXRAcousticLevelPrefetch::Get().Take(FullFilePath);
+  if (Prefetched.IsValid() && !Prefetched->Wait())
+    Prefetched = FMetaXRAcousticLevelPrefetch::Get().Take(FullFilePath);
+  if (Prefetched.IsValid() && Prefetched->Wait() &&
+      FMetaXRAcousticContainer::ReadSceneIR(CachedMap, Prefetched->GetData(), Prefetched->GetSize(), SceneHash) == ovrSuccess) {
+    METAXR_AUDIO_LOG("Loaded acoustic map from prefetched file: %s to %p", *FullFilePath, CachedMap);
+    EnableLoadedMap();
     return;
   }
 
-  ovrResult Result;
-  Result = OVRA_CALL(ovrAudio_AudioSceneIRReadMemory)(CachedMap, (const int8_t*)FileData.GetData(), FileData.Num());
+  const ovrResult Result = ReadSceneIRFromFile(CachedMap, FullFilePath, SceneHash);
   if (Result != ovrSuccess) {
     METAXR_AUDIO_LOG_WARNING("Unable to read audio acoustic map from memory: %s", *FullFilePath);
     return;
@@ -316,8 +354,12 @@ void UMetaXRAcousticMap::LoadData() {
     METAXR_AUDIO_LOG("Loaded acoustic map from memory: %s to %p", *FullFilePath, CachedMap);
   }
 
+  EnableLoadedMap();
+}
+
+void UMetaXRAcousticMap::EnableLoadedMap() {
   // Now that the map is loaded ensure that it is enabled
-  Result = OVRA_CALL(ovrAudio_AudioSceneIRSetEnabled)(CachedMap, true);
+  const ovrResult Result = OVRA_CALL(ovrAudio_AudioSceneIRSetEnabled)(CachedMap, true);
   if (Result != ovrSuccess) {
     METAXR_AUDIO_LOG_WARNING("Failed to enable Acoustic Map %p", CachedMap);
   } else {
@@ -472,6 +514,11 @@ void UMetaXRAcousticMap::FinishCompute() {
       METAXR_AUDIO_LOG_WARNING("Error writing Acoustic Map to file");
     } else {
       METAXR_AUDIO_LOG_DISPLAY("Acoustic Map finished generating to %s", *FullFilePath);
+      // Saved with the level so loads can tell the file apart from one baked for another version of the scene
+      SceneHash = Hash;
+      MarkPackageDirty();
+      if (GetDefault<UMetaXRAcousticProjectSettings>()->bCompressBakedData)
+        FMetaXRAcousticContainer::CompressFile(FullFilePath, Hash);
     }
   }
 
@@ -523,7 +570,8 @@ void UMetaXRAcousticMap::GatherGeometriesAndMaterials() {
   for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr) {
     AActor* CurrentActor = *ActorItr;
     UMetaXRAcousticGeometry* GeometryComponent = CurrentActor->FindComponentByClass<UMetaXRAcousticGeometry>();
-    if (GeometryComponent) {
+    // Geometry merged into chunks is baked through the chunks instead
+    if (GeometryComponent && !GeometryComponent->IsMergedIntoChunk()) {
       GeometryList.Add(GeometryComponent);
     }
 
@@ -703,6 +751,11 @@ void UMetaXRAcousticMap::PostEditChangeProperty(struct FPropertyChangedEvent& Pr
   Super::PostEditChangeProperty(PropertyChangedEvent);
 }
 
+void UMetaXRAcousticMap::PreSave(FObjectPreSaveContext ObjectSaveContext) {
+  Super::PreSave(ObjectSaveContext);
+  UMetaXRAcousticBakedData::AttachForCook(this, FilePath, BakedData, ObjectSaveContext);
+}
+
 void UMetaXRAcousticMap::PostEditComponentMove(bool bFinished) {
   ApplyTransform();
 }
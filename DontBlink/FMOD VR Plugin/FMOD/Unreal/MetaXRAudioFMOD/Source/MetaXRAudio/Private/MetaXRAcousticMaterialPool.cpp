@@ -0,0 +1,92 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#include "MetaXRAcousticMaterialPool.h"
+#include "MetaXRAcousticMaterialProperties.h"
+#include "MetaXRAudioContext.h"
+#include "MetaXRAudioLogging.h"
+
+FMetaXRAcousticMaterialPool& FMetaXRAcousticMaterialPool::Get() {
+  static FMetaXRAcousticMaterialPool Pool;
+  return Pool;
+}
+
+ovrAudioMaterial FMetaXRAcousticMaterialPool::Acquire(ovrAudioContext Context, const UMetaXRAcousticMaterialProperties* Properties) {
+  FString Hash;
+  if (Properties)
+    Properties->AppendHash(Hash);
+
+  FScopeLock Lock(&CS);
+  for (TPair<ovrAudioMaterial, FEntry>& Pair : Entries) {
+    FEntry& Entry = Pair.Value;
+    if (Entry.Context == Context && Entry.Properties == Properties && Entry.Hash == Hash) {
+      Entry.RefCount++;
+      return Pair.Key;
+    }
+  }
+
+  ovrAudioMaterial Material = nullptr;
+  if (OVRA_CALL(ovrAudio_CreateAudioMaterial)(Context, &Material) != ovrSuccess) {
+    METAXR_AUDIO_LOG_WARNING("Unable to create audio material");
+    return nullptr;
+  }
+
+  if (Properties)
+    Properties->ConstructMaterial(Material);
+
+  FEntry& Entry = Entries.Add(Material);
+  Entry.Context = Context;
+  Entry.Properties = Properties;
+  Entry.Hash = MoveTemp(Hash);
+  Entry.RefCount = 1;
+  return Material;
+}
+
+void FMetaXRAcousticMaterialPool::Release(ovrAudioMaterial Material) {
+  if (Material == nullptr)
+    return;
+
+  FScopeLock Lock(&CS);
+  FEntry* Entry = Entries.Find(Material);
+  if (!Entry) {
+    METAXR_AUDIO_LOG_WARNING("Released audio material %p that is not in the pool", Material);
+    return;
+  }
+
+  if (--Entry->RefCount > 0)
+    return;
+
+  Entries.Remove(Material);
+  if (OVRA_CALL(ovrAudio_DestroyAudioMaterial)(Material) != ovrSuccess)
+    METAXR_AUDIO_LOG_WARNING("Failed to destroy material %p", Material);
+}
+
+int32 FMetaXRAcousticMaterialPool::GetNumMaterials() const {
+  FScopeLock Lock(&CS);
+  return Entries.Num();
+}
+
+bool FMetaXRAcousticMaterialRefs::Find(const UMetaXRAcousticMaterialProperties* Properties, ovrAudioMaterial& OutMaterial) {
+  if (ovrAudioMaterial* Existing = Materials.Find(Properties)) {
+    OutMaterial = *Existing;
+    return true;
+  }
+
+  OutMaterial = FMetaXRAcousticMaterialPool::Get().Acquire(Context, Properties);
+  if (OutMaterial == nullptr)
+    return false;
+
+  Materials.Add(Properties, OutMaterial);
+  return true;
+}
+
+TArray<ovrAudioMaterial> FMetaXRAcousticMaterialRefs::Detach() {
+  TArray<ovrAudioMaterial> Detached;
+  Materials.GenerateValueArray(Detached);
+  Materials.Empty();
+  return Detached;
+}
+
+void FMetaXRAcousticMaterialRefs::ReleaseAll(const TArray<ovrAudioMaterial>& Materials) {
+  for (ovrAudioMaterial Material : Materials)
+    FMetaXRAcousticMaterialPool::Get().Release(Material);
+}
@@ -0,0 +1,58 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MetaXR_Audio.h"
+#include "MetaXR_Audio_AcousticRayTracing.h"
+
+class UMetaXRAcousticMaterialProperties;
+
+// Shares ovrAudioMaterial handles between every geometry in a context. A handle is built once per properties asset and spectrum
+// and stays alive while any geometry holds a reference to it. Editing an asset's spectrum changes its hash, so the next acquire
+// builds a fresh handle while geometries still holding the old one keep it until they release it.
+class FMetaXRAcousticMaterialPool {
+ public:
+  static FMetaXRAcousticMaterialPool& Get();
+
+  // Returns a handle for the current spectrum of Properties with one reference added, or nullptr on failure.
+  // A null Properties yields the SDK's default material.
+  ovrAudioMaterial Acquire(ovrAudioContext Context, const UMetaXRAcousticMaterialProperties* Properties);
+  void Release(ovrAudioMaterial Material);
+
+  int32 GetNumMaterials() const;
+
+ private:
+  struct FEntry {
+    ovrAudioContext Context = nullptr;
+    const UMetaXRAcousticMaterialProperties* Properties = nullptr;
+    FString Hash;
+    int32 RefCount = 0;
+  };
+
+  mutable FCriticalSection CS;
+  TMap<ovrAudioMaterial, FEntry> Entries;
+};
+
+// The pooled materials one geometry upload references. Each properties asset is looked up once per upload no matter how many
+// sections or instances use it; whatever is not detached is released when this goes out of scope.
+class FMetaXRAcousticMaterialRefs {
+ public:
+  explicit FMetaXRAcousticMaterialRefs(ovrAudioContext InContext) : Context(InContext) {}
+  ~FMetaXRAcousticMaterialRefs() {
+    ReleaseAll(Detach());
+  }
+
+  FMetaXRAcousticMaterialRefs(const FMetaXRAcousticMaterialRefs&) = delete;
+  FMetaXRAcousticMaterialRefs& operator=(const FMetaXRAcousticMaterialRefs&) = delete;
+
+  bool Find(const UMetaXRAcousticMaterialProperties* Properties, ovrAudioMaterial& OutMaterial);
+
+  // Hands the references over to the caller, who must eventually pass them to ReleaseAll
+  TArray<ovrAudioMaterial> Detach();
+  static void ReleaseAll(const TArray<ovrAudioMaterial>& Materials);
+
+ private:
+  ovrAudioContext Context;
+  TMap<const UMetaXRAcousticMaterialProperties*, ovrAudioMaterial> Materials;
+};
@@ -27,7 +27,7 @@ void UMetaXRAcousticMaterialProperties::AppendHash(FString& hash) const {
   hash.Append(FMD5::HashAnsiString(*materialHash));
 }
 
-void UMetaXRAcousticMaterialProperties::ConstructMaterial(ovrAudioMaterial ovrMaterial) {
+void UMetaXRAcousticMaterialProperties::ConstructMaterial(ovrAudioMaterial ovrMaterial) const {
   const FMetaXRAcousticMaterialData& MaterialData = Data;
 
   if (MaterialData.IsEmpty() || !ovrMaterial) {
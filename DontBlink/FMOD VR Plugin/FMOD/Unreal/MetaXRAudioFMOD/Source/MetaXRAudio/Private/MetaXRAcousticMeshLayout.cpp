@@ -0,0 +1,77 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#include "MetaXRAcousticMeshLayout.h"
+#include "Algo/Sort.h"
+
+// Cells along the longest side of the bounds; 10 bits per axis so the code fits 30 bits
+static constexpr uint32 MortonCellCount = 1024;
+
+// Spreads the low 10 bits of Value so that two zero bits follow each of them
+static uint32 SpreadBits(uint32 Value) {
+  Value &= 0x3ff;
+  Value = (Value | (Value << 16)) & 0x030000ff;
+  Value = (Value | (Value << 8)) & 0x0300f00f;
+  Value = (Value | (Value << 4)) & 0x030c30c3;
+  Value = (Value | (Value << 2)) & 0x09249249;
+  return Value;
+}
+
+// Cubic cells, so the curve doesn't stretch along the short sides
+static float GetMortonScale(const FBox3f& Bounds) {
+  return (MortonCellCount - 1) / FMath::Max(Bounds.GetSize().GetMax(), UE_KINDA_SMALL_NUMBER);
+}
+
+static uint32 GetMortonCode(const FVector3f& Position, const FVector3f& Origin, const float Scale) {
+  const FVector3f Cell = (Position - Origin) * Scale;
+  const auto Quantize = [](float Value) { return static_cast<uint32>(FMath::Clamp(Value, 0.0f, MortonCellCount - 1.0f)); };
+  return SpreadBits(Quantize(Cell.X)) | (SpreadBits(Quantize(Cell.Y)) << 1) | (SpreadBits(Quantize(Cell.Z)) << 2);
+}
+
+uint32 MetaXRAcousticMeshLayout::GetMortonCode(const FVector3f& Position, const FBox3f& Bounds) {
+  return ::GetMortonCode(Position, Bounds.Min, GetMortonScale(Bounds));
+}
+
+void MetaXRAcousticMeshLayout::SortMorton(TArray<FVector3f>& Vertices, TArray<uint32>& Indices, TArray<ovrAudioMeshGroup>& MeshGroups) {
+  if (Vertices.IsEmpty() || Indices.IsEmpty())
+    return;
+
+  const FBox3f Bounds(Vertices);
+  const float Scale = GetMortonScale(Bounds);
+
+  TArray<FVector3f> SortedVertices;
+  SortedVertices.Reserve(Vertices.Num());
+  TArray<uint32> SortedIndices;
+  SortedIndices.Reserve(Indices.Num());
+  TArray<uint32> Remap;
+  Remap.Init(MAX_uint32, Vertices.Num());
+
+  // Morton code in the high half and face in the low half, so sorting the keys orders the faces
+  TArray<uint64> Keys;
+  for (ovrAudioMeshGroup& MeshGroup : MeshGroups) {
+    const int32 FaceSize = MeshGroup.faceType == ovrAudioFaceType_Quads ? 4 : 3;
+    const int32 FaceCount = static_cast<int32>(MeshGroup.faceCount);
+    Keys.Reset(FaceCount);
+    for (int32 Face = 0; Face < FaceCount; Face++) {
+      FVector3f Centroid = FVector3f::ZeroVector;
+      for (int32 Corner = 0; Corner < FaceSize; Corner++)
+        Centroid += Vertices[Indices[MeshGroup.indexOffset + Face * FaceSize + Corner]];
+      Keys.Add((static_cast<uint64>(GetMortonCode(Centroid / FaceSize, Bounds.Min, Scale)) << 32) | static_cast<uint32>(Face));
+    }
+    Algo::Sort(Keys);
+
+    const int32 FirstIndex = SortedIndices.Num();
+    for (const uint64 Key : Keys) {
+      const int32 Face = static_cast<int32>(Key & MAX_uint32);
+      for (int32 Corner = 0; Corner < FaceSize; Corner++) {
+        const uint32 Vertex = Indices[MeshGroup.indexOffset + Face * FaceSize + Corner];
+        if (Remap[Vertex] == MAX_uint32)
+          Remap[Vertex] = SortedVertices.Add(Vertices[Vertex]);
+        SortedIndices.Add(Remap[Vertex]);
+      }
+    }
+    MeshGroup.indexOffset = FirstIndex;
+  }
+
+  Vertices = MoveTemp(SortedVertices);
+  Indices = MoveTemp(SortedIndices);
+}
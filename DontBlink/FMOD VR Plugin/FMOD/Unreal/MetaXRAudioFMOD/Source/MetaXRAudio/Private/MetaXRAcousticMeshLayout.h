@@ -0,0 +1,17 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MetaXR_Audio.h"
+#include "MetaXR_Audio_AcousticRayTracing.h"
+
+// Spatial layout of mesh arrays before they are handed to the SDK. Gathered meshes arrive in traversal order, which leaves faces
+// that touch in space far apart in memory for the simplifier and the acceleration structure build.
+namespace MetaXRAcousticMeshLayout {
+// Sorts each mesh group's faces along a Morton curve through their centroids and renumbers the vertices in the order the sorted
+// faces first use them. Mesh groups keep their order and materials; vertices no face uses are dropped.
+void SortMorton(TArray<FVector3f>& Vertices, TArray<uint32>& Indices, TArray<ovrAudioMeshGroup>& MeshGroups);
+// The code SortMorton orders a face by, from its centroid and the bounds of the mesh's vertices
+uint32 GetMortonCode(const FVector3f& Position, const FBox3f& Bounds);
+} // namespace MetaXRAcousticMeshLayout
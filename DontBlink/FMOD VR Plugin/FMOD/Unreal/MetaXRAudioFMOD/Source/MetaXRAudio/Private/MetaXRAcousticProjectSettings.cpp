@@ -14,7 +14,9 @@
 #endif // WITH_EDITOR
 
 UMetaXRAcousticProjectSettings::UMetaXRAcousticProjectSettings()
-    : AcousticModel(EMetaXRAudioAcousticModel::Automatic), bDiffractionEnabled(true), ExcludeTags(), bMapBakeWriteGeo(true) {}
+    : AcousticModel(EMetaXRAudioAcousticModel::Automatic), bDiffractionEnabled(true), ExcludeTags(), MinMeshSize(0.0f),
+      MinMeshSizeErrorRatio(0.0f), GeometryChunkSize(5000.0f), bMapBakeWriteGeo(true), bCookBakedData(false),
+      bCookLevelManifests(true), bCookLevelPacks(false), bCompressBakedData(false) {}
 
 void UMetaXRAcousticProjectSettings::PostInitProperties() {
   // Ensure the settings are applied when the project or game is loaded
@@ -0,0 +1,173 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#include "MetaXRAcousticTriangleBudget.h"
+
+#if WITH_EDITOR
+#include "EngineUtils.h"
+#include "GameFramework/PlayerStart.h"
+#include "MetaXRAcousticGeometry.h"
+#include "MetaXRAudioLogging.h"
+#include "MetaXRAudioUtilities.h"
+#include "Misc/FileHelper.h"
+
+// Bisection steps over the log of the error scale; each step re-simplifies only the geometry whose error changed
+static constexpr int32 SolverIterations = 12;
+
+FMetaXRAcousticTriangleBudgetSolver::FMetaXRAcousticTriangleBudgetSolver(UWorld* InWorld, const FMetaXRAcousticTriangleBudget& InBudget)
+    : World(InWorld), Budget(InBudget) {}
+
+void FMetaXRAcousticTriangleBudgetSolver::GatherEntries() {
+  Entries.Empty();
+
+  TArray<FVector> PlayerStarts;
+  for (TActorIterator<APlayerStart> ActorItr(World); ActorItr; ++ActorItr)
+    PlayerStarts.Add(ActorItr->GetActorLocation());
+
+  for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr) {
+    TInlineComponentArray<UMetaXRAcousticGeometry*> Geometries(*ActorItr);
+    for (UMetaXRAcousticGeometry* Geometry : Geometries) {
+      if (!Geometry->IsFileEnabled() || Geometry->IsMergedIntoChunk())
+        continue;
+
+      FEntry& Entry = Entries.AddDefaulted_GetRef();
+      Entry.Geometry = Geometry;
+      const FBox Bounds = Geometry->CalcBounds(Geometry->GetComponentTransform()).GetBox();
+      Entry.Size = Bounds.IsValid ? static_cast<float>(Bounds.GetSize().Size()) : 0.0f;
+      if (!PlayerStarts.IsEmpty() && Bounds.IsValid) {
+        double SquaredDistance = TNumericLimits<double>::Max();
+        for (const FVector& PlayerStart : PlayerStarts)
+          SquaredDistance = FMath::Min(SquaredDistance, Bounds.ComputeSquaredDistanceToPoint(PlayerStart));
+        Entry.PlayableDistance = static_cast<float>(FMath::Sqrt(SquaredDistance));
+      }
+    }
+  }
+
+  // Sizes are relative to the geometric mean so the weights stay centered on 1 whatever the scale of the level
+  double LogSizeSum = 0.0;
+  for (const FEntry& Entry : Entries)
+    LogSizeSum += FMath::Loge(FMath::Max(Entry.Size, 1.0f));
+  const double MeanSize = Entries.IsEmpty() ? 1.0 : FMath::Exp(LogSizeSum / Entries.Num());
+
+  for (FEntry& Entry : Entries) {
+    const double RelativeSize = FMath::Max(Entry.Size, 1.0f) / MeanSize;
+    const double Proximity = 1.0 / (1.0 + Entry.PlayableDistance / Budget.PlayableFalloff);
+    Entry.Weight = static_cast<float>(FMath::Max(RelativeSize * Proximity, UE_KINDA_SMALL_NUMBER));
+  }
+}
+
+float FMetaXRAcousticTriangleBudgetSolver::GetMaxError(const FEntry& Entry, float Scale) const {
+  return FMath::Clamp(Scale / Entry.Weight, Budget.MinMaxError, Budget.MaxMaxError);
+}
+
+int32 FMetaXRAcousticTriangleBudgetSolver::CountTriangles(FEntry& Entry, float InMaxError) {
+  const int32 Key = FMath::RoundToInt(InMaxError * 100.0f);
+  if (const int32* Count = Entry.TriangleCounts.Find(Key))
+    return *Count;
+
+  int32 Count = 0;
+  if (!Entry.Geometry->CountSimplifiedTriangles(InMaxError, Count))
+    METAXR_AUDIO_LOG_WARNING("Unable to simplify %s for the triangle budget", *Entry.Geometry->GetReadableName());
+  Entry.TriangleCounts.Add(Key, Count);
+  return Count;
+}
+
+int64 FMetaXRAcousticTriangleBudgetSolver::CountTotalTriangles(float Scale) {
+  int64 Total = 0;
+  for (FEntry& Entry : Entries)
+    Total += CountTriangles(Entry, GetMaxError(Entry, Scale));
+  return Total;
+}
+
+bool FMetaXRAcousticTriangleBudgetSolver::Bake() {
+  GatherEntries();
+  if (Entries.IsEmpty()) {
+    METAXR_AUDIO_LOG_WARNING("No file enabled acoustic geometry found to bake to the %s triangle budget", *Budget.Platform);
+    return false;
+  }
+
+  float MinWeight = TNumericLimits<float>::Max();
+  float MaxWeight = 0.0f;
+  for (const FEntry& Entry : Entries) {
+    MinWeight = FMath::Min(MinWeight, Entry.Weight);
+    MaxWeight = FMath::Max(MaxWeight, Entry.Weight);
+  }
+
+  // At LowScale every geometry is at the smallest error and at HighScale every geometry is at the largest
+  double LowScale = FMath::Loge(FMath::Max(Budget.MinMaxError * MinWeight, UE_KINDA_SMALL_NUMBER));
+  double HighScale = FMath::Loge(FMath::Max(Budget.MaxMaxError * MaxWeight, UE_KINDA_SMALL_NUMBER));
+  const bool bWithinBudget = CountTotalTriangles(FMath::Exp(HighScale)) <= Budget.MaxTriangles;
+  if (!bWithinBudget) {
+    METAXR_AUDIO_LOG_WARNING(
+        "The %s triangle budget of %i can't be met with errors up to %f cm, baking at the largest error",
+        *Budget.Platform,
+        Budget.MaxTriangles,
+        Budget.MaxMaxError);
+  } else if (CountTotalTriangles(FMath::Exp(LowScale)) <= Budget.MaxTriangles) {
+    HighScale = LowScale;
+  } else {
+    for (int32 Iteration = 0; Iteration < SolverIterations; ++Iteration) {
+      const double MidScale = 0.5 * (LowScale + HighScale);
+      if (CountTotalTriangles(FMath::Exp(MidScale)) <= Budget.MaxTriangles)
+        HighScale = MidScale;
+      else
+        LowScale = MidScale;
+    }
+  }
+
+  bool bSucceeded = bWithinBudget;
+  TArray<FString> FilePathsToCheckout;
+  const float Scale = FMath::Exp(HighScale);
+  for (FEntry& Entry : Entries) {
+    Entry.MaxError = GetMaxError(Entry, Scale);
+    Entry.TriangleCount = CountTriangles(Entry, Entry.MaxError);
+
+    UMetaXRAcousticGeometry* Geometry = Entry.Geometry;
+    Geometry->Modify();
+    Geometry->MaxError = Entry.MaxError;
+    if (!Geometry->WriteFile()) {
+      METAXR_AUDIO_LOG_WARNING("Failed to bake %s for the triangle budget", *Geometry->GetReadableName());
+      bSucceeded = false;
+      continue;
+    }
+    FilePathsToCheckout.Add(FPaths::ProjectContentDir() / Geometry->GetFilePath());
+  }
+  MetaXRAudioUtilities::CheckOutFilesInSourceControl(FilePathsToCheckout);
+
+  return WriteReport(bWithinBudget) && bSucceeded;
+}
+
+bool FMetaXRAcousticTriangleBudgetSolver::WriteReport(bool bWithinBudget) {
+  int64 TotalTriangles = 0;
+  FString Report = TEXT("Geometry,Size (cm),Playable Distance (cm),Weight,Max Error (cm),Triangles\n");
+  for (const FEntry& Entry : Entries) {
+    TotalTriangles += Entry.TriangleCount;
+    Report += FString::Printf(
+        TEXT("%s,%.1f,%.1f,%.3f,%.2f,%i\n"),
+        *Entry.Geometry->GetReadableName(),
+        Entry.Size,
+        Entry.PlayableDistance,
+        Entry.Weight,
+        Entry.MaxError,
+        Entry.TriangleCount);
+  }
+  Report += FString::Printf(TEXT("Total,,,,,%lld\n"), TotalTriangles);
+  Report += FString::Printf(TEXT("Budget (%s),,,,,%i\n"), *Budget.Platform, Budget.MaxTriangles);
+
+  ReportPath = FPaths::ProjectSavedDir() / TEXT(META_XR_AUDIO_DEFAULT_SAVE_FOLDER) /
+      FString::Printf(TEXT("TriangleBudget_%s_%s.csv"), *World->GetMapName(), *FPaths::MakeValidFileName(Budget.Platform));
+  if (!FFileHelper::SaveStringToFile(Report, *ReportPath)) {
+    METAXR_AUDIO_LOG_WARNING("Unable to write the triangle budget report to %s", *ReportPath);
+    return false;
+  }
+
+  METAXR_AUDIO_LOG_DISPLAY(
+      "Baked %i acoustic geometries to %lld of %i triangles for %s%s, report written to %s",
+      Entries.Num(),
+      TotalTriangles,
+      Budget.MaxTriangles,
+      *Budget.Platform,
+      bWithinBudget ? TEXT("") : TEXT(" (over budget)"),
+      *ReportPath);
+  return true;
+}
+#endif // WITH_EDITOR
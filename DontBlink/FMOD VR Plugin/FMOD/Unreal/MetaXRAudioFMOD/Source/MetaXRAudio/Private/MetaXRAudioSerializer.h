@@ -0,0 +1,205 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#pragma once
+
+#include "Async/AsyncFileHandle.h"
+#include "CoreMinimal.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "MetaXR_Audio.h"
+
+// Adapters that expose engine file/memory sources as an ovrAudioSerializer so the SDK can parse geometry and maps
+// straight from the source, without first copying the whole file into a TArray.
+// Seek is relative to the current position and returns the actual change, matching the SDK contract.
+
+// Streams from (or to) a synchronous IFileHandle.
+class FMetaXRAudioFileSerializer {
+ public:
+  explicit FMetaXRAudioFileSerializer(IFileHandle* InHandle) : Handle(InHandle) {}
+
+  ovrAudioSerializer GetSerializer() {
+    ovrAudioSerializer Serializer;
+    Serializer.read = Read;
+    Serializer.write = Write;
+    Serializer.seek = Seek;
+    Serializer.userData = this;
+    return Serializer;
+  }
+
+ private:
+  static size_t Read(void* userData, void* bytes, size_t byteCount) {
+    FMetaXRAudioFileSerializer* Self = static_cast<FMetaXRAudioFileSerializer*>(userData);
+    return Self->Handle->Read(static_cast<uint8*>(bytes), byteCount) ? byteCount : 0;
+  }
+
+  static size_t Write(void* userData, const void* bytes, size_t byteCount) {
+    FMetaXRAudioFileSerializer* Self = static_cast<FMetaXRAudioFileSerializer*>(userData);
+    return Self->Handle->Write(static_cast<const uint8*>(bytes), byteCount) ? byteCount : 0;
+  }
+
+  static int64_t Seek(void* userData, int64_t seekOffset) {
+    FMetaXRAudioFileSerializer* Self = static_cast<FMetaXRAudioFileSerializer*>(userData);
+    const int64 Start = Self->Handle->Tell();
+    const int64 Target = FMath::Clamp<int64>(Start + seekOffset, 0, Self->Handle->Size());
+    return Self->Handle->Seek(Target) ? Target - Start : 0;
+  }
+
+  IFileHandle* Handle;
+};
+
+// Reads from a block of memory that is owned elsewhere, e.g. a memory-mapped file region.
+class FMetaXRAudioMemorySerializer {
+ public:
+  FMetaXRAudioMemorySerializer(const uint8* InData, int64 InSize) : Data(InData), Size(InSize) {}
+
+  ovrAudioSerializer GetSerializer() {
+    ovrAudioSerializer Serializer;
+    Serializer.read = Read;
+    Serializer.write = nullptr;
+    Serializer.seek = Seek;
+    Serializer.userData = this;
+    return Serializer;
+  }
+
+ private:
+  static size_t Read(void* userData, void* bytes, size_t byteCount) {
+    FMetaXRAudioMemorySerializer* Self = static_cast<FMetaXRAudioMemorySerializer*>(userData);
+    if (Self->Pos + static_cast<int64>(byteCount) > Self->Size)
+      return 0;
+
+    FMemory::Memcpy(bytes, Self->Data + Self->Pos, byteCount);
+    Self->Pos += byteCount;
+    return byteCount;
+  }
+
+  static int64_t Seek(void* userData, int64_t seekOffset) {
+    FMetaXRAudioMemorySerializer* Self = static_cast<FMetaXRAudioMemorySerializer*>(userData);
+    const int64 Start = Self->Pos;
+    Self->Pos = FMath::Clamp<int64>(Start + seekOffset, 0, Self->Size);
+    return Self->Pos - Start;
+  }
+
+  const uint8* Data;
+  int64 Size;
+  int64 Pos = 0;
+};
+
+// Writes into (or reads back from) a growable array, e.g. to capture geometry data the SDK serializes without touching disk.
+class FMetaXRAudioArraySerializer {
+ public:
+  explicit FMetaXRAudioArraySerializer(TArray<uint8>& InData) : Data(InData) {}
+
+  ovrAudioSerializer GetSerializer() {
+    ovrAudioSerializer Serializer;
+    Serializer.read = Read;
+    Serializer.write = Write;
+    Serializer.seek = Seek;
+    Serializer.userData = this;
+    return Serializer;
+  }
+
+ private:
+  static size_t Read(void* userData, void* bytes, size_t byteCount) {
+    FMetaXRAudioArraySerializer* Self = static_cast<FMetaXRAudioArraySerializer*>(userData);
+    if (Self->Pos + static_cast<int64>(byteCount) > Self->Data.Num())
+      return 0;
+
+    FMemory::Memcpy(bytes, Self->Data.GetData() + Self->Pos, byteCount);
+    Self->Pos += byteCount;
+    return byteCount;
+  }
+
+  static size_t Write(void* userData, const void* bytes, size_t byteCount) {
+    FMetaXRAudioArraySerializer* Self = static_cast<FMetaXRAudioArraySerializer*>(userData);
+    const int64 End = Self->Pos + static_cast<int64>(byteCount);
+    if (End > Self->Data.Num())
+      Self->Data.SetNumUninitialized(End);
+
+    FMemory::Memcpy(Self->Data.GetData() + Self->Pos, bytes, byteCount);
+    Self->Pos = End;
+    return byteCount;
+  }
+
+  static int64_t Seek(void* userData, int64_t seekOffset) {
+    FMetaXRAudioArraySerializer* Self = static_cast<FMetaXRAudioArraySerializer*>(userData);
+    const int64 Start = Self->Pos;
+    Self->Pos = FMath::Clamp<int64>(Start + seekOffset, 0, Self->Data.Num());
+    return Self->Pos - Start;
+  }
+
+  TArray<uint8>& Data;
+  int64 Pos = 0;
+};
+
+// Pulls from an IAsyncReadFileHandle, blocking the calling worker on each request. Large reads land directly in the SDK's
+// buffer; small reads are served from a read-ahead window so the SDK's header/field reads don't each become an IO request.
+// An optional cancel flag makes reads fail so the SDK unwinds early.
+class FMetaXRAudioAsyncFileSerializer {
+ public:
+  FMetaXRAudioAsyncFileSerializer(IAsyncReadFileHandle* InHandle, int64 InSize, const std::atomic<bool>* InCancelled = nullptr)
+      : Handle(InHandle), Size(InSize), Cancelled(InCancelled) {}
+
+  ovrAudioSerializer GetSerializer() {
+    ovrAudioSerializer Serializer;
+    Serializer.read = Read;
+    Serializer.write = nullptr;
+    Serializer.seek = Seek;
+    Serializer.userData = this;
+    return Serializer;
+  }
+
+ private:
+  static constexpr int64 ReadAheadSize = 64 * 1024;
+
+  bool ReadFromFile(int64 Offset, int64 Count, uint8* Dest) {
+    IAsyncReadRequest* Request = Handle->ReadRequest(Offset, Count, AIOP_Normal, nullptr, Dest);
+    if (Request == nullptr)
+      return false;
+
+    Request->WaitCompletion();
+    const bool bRead = Request->GetReadResults() != nullptr;
+    delete Request;
+    return bRead;
+  }
+
+  static size_t Read(void* userData, void* bytes, size_t byteCount) {
+    FMetaXRAudioAsyncFileSerializer* Self = static_cast<FMetaXRAudioAsyncFileSerializer*>(userData);
+    const int64 Count = static_cast<int64>(byteCount);
+    if ((Self->Cancelled && *Self->Cancelled) || Self->Pos + Count > Self->Size)
+      return 0;
+
+    uint8* Dest = static_cast<uint8*>(bytes);
+    if (Count >= ReadAheadSize) {
+      if (!Self->ReadFromFile(Self->Pos, Count, Dest))
+        return 0;
+    } else {
+      const bool bInWindow = Self->Pos >= Self->WindowOffset && Self->Pos + Count <= Self->WindowOffset + Self->Window.Num();
+      if (!bInWindow) {
+        Self->WindowOffset = Self->Pos;
+        Self->Window.SetNumUninitialized(static_cast<int32>(FMath::Min(ReadAheadSize, Self->Size - Self->Pos)));
+        if (!Self->ReadFromFile(Self->WindowOffset, Self->Window.Num(), Self->Window.GetData())) {
+          Self->Window.Reset();
+          return 0;
+        }
+      }
+      FMemory::Memcpy(Dest, Self->Window.GetData() + (Self->Pos - Self->WindowOffset), Count);
+    }
+
+    Self->Pos += Count;
+    return byteCount;
+  }
+
+  static int64_t Seek(void* userData, int64_t seekOffset) {
+    FMetaXRAudioAsyncFileSerializer* Self = static_cast<FMetaXRAudioAsyncFileSerializer*>(userData);
+    const int64 Start = Self->Pos;
+    Self->Pos = FMath::Clamp<int64>(Start + seekOffset, 0, Self->Size);
+    return Self->Pos - Start;
+  }
+
+  IAsyncReadFileHandle* Handle;
+  int64 Size;
+  const std::atomic<bool>* Cancelled;
+  int64 Pos = 0;
+  TArray<uint8> Window;
+  int64 WindowOffset = 0;
+};
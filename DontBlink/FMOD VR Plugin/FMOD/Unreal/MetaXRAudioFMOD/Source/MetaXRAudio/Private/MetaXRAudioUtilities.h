@@ -38,6 +38,21 @@ class MetaXRAudioUtilities {
     return FVector3f(-InVec.Z, InVec.X, InVec.Y);
   }
 
+  // Appends the UE to OVR axis swap to a UE transform, so a single TransformPosition yields ToOVRVector(InMatrix.TransformPosition(V))
+  static FMatrix ToOVRMatrix(const FMatrix& InMatrix) {
+    return InMatrix * GetOVRAxisSwap();
+  }
+
+  // Prepends the UE to OVR axis swap, for geometry whose vertices were uploaded in UE axes rather than converted. The OVR transform
+  // of the result maps those raw vertices to the same place the OVR transform of InMatrix maps converted ones.
+  static FMatrix ToOVRMeshSpaceMatrix(const FMatrix& InMatrix) {
+    return GetOVRAxisSwap() * InMatrix;
+  }
+
+  static FMatrix GetOVRAxisSwap() {
+    return FMatrix(FPlane(0, 0, -1, 0), FPlane(1, 0, 0, 0), FPlane(0, 1, 0, 0), FPlane(0, 0, 0, 1));
+  }
+
   static FVector ToOVRVector(const Audio::FChannelPositionInfo& ChannelPositionInfo) {
     FVector OvrVector;
     OvrVector.X = ChannelPositionInfo.Radius * FMath::Sin(ChannelPositionInfo.Azimuth) * FMath::Cos(ChannelPositionInfo.Elevation);
@@ -57,10 +72,13 @@ class MetaXRAudioUtilities {
   }
 
   static void ConvertUETransformToOVRTransform(const FTransform& InTransform, float OutTransform[16]) {
+    ConvertUEMatrixToOVRTransform(InTransform.ToMatrixWithScale(), OutTransform);
+  }
+
+  static void ConvertUEMatrixToOVRTransform(const FMatrix& Matrix, float OutTransform[16]) {
     // UE:        x:forward, y:right, z:up
     // Meta XR:  x:right,   y:up,    z:backward
     // UE y = Meta x | UE z = meta y | negative UE x = meta z
-    const FMatrix Matrix = InTransform.ToMatrixWithScale();
     OutTransform[0] = (float)Matrix.M[1][1];
     OutTransform[1] = (float)Matrix.M[1][2];
     OutTransform[2] = (float)-Matrix.M[1][0];
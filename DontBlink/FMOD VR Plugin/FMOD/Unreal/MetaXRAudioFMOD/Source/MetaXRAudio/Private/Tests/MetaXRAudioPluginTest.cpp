@@ -1,9 +1,16 @@
 // (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
 
+#include "Algo/Sort.h"
 #include "HAL/FileManager.h"
 #include "Interfaces/IPluginManager.h"
+#include "Math/RandomStream.h"
+#include "MetaXRAcousticContainer.h"
+#include "MetaXRAcousticGeometryCache.h"
+#include "MetaXRAcousticHeightfield.h"
+#include "MetaXRAcousticMeshLayout.h"
 #include "MetaXRAudioDllManager.h"
 #include "MetaXRAudioPlatform.h"
+#include "MetaXRAudioSerializer.h"
 #include "MetaXR_Audio.h"
 #include "MetaXR_Audio_AcousticRayTracing.h"
 #include "Misc/AutomationTest.h"
@@ -356,6 +363,55 @@ bool FApiCallsTest::RunTest(const FString& Parameters) {
     Serializer.Pos = 0;
     OVR_AUDIO_TEST(OVRA_CALL(ovrAudio_AudioGeometryReadMeshData)(Geometry, &AudioSerializer), Context);
 
+    // Compressed container round trip, plus the raw fallback through the same entry point
+    TArray<uint8> Container;
+    if (!FMetaXRAcousticContainer::Compress(Serializer.Data.GetData(), Serializer.Data.Num(), TEXT("ApiCalls"), Container) ||
+        !FMetaXRAcousticContainer::IsContainer(Container.GetData(), Container.Num())) {
+      UE_LOG(LogMetaXRAudio, Error, TEXT("Failed to compress mesh data into an acoustic container"));
+      IsTestSuccessful = false;
+    }
+    FMetaXRAudioMemorySerializer ContainerSerializer(Container.GetData(), Container.Num());
+    OVR_AUDIO_TEST(FMetaXRAcousticContainer::ReadGeometry(Geometry, ContainerSerializer.GetSerializer()), Context);
+    FMetaXRAudioMemorySerializer RawSerializer(Serializer.Data.GetData(), Serializer.Data.Num());
+    OVR_AUDIO_TEST(FMetaXRAcousticContainer::ReadGeometry(Geometry, RawSerializer.GetSerializer()), Context);
+
+    // A container baked from other source data needs a rebake but is still read
+    FMetaXRAudioMemorySerializer MatchingSerializer(Container.GetData(), Container.Num());
+    const ovrResult MatchingResult =
+        FMetaXRAcousticContainer::ReadGeometry(Geometry, MatchingSerializer.GetSerializer(), nullptr, TEXT("ApiCalls"));
+    OVR_AUDIO_TEST(MatchingResult, Context);
+    FMetaXRAudioMemorySerializer StaleSerializer(Container.GetData(), Container.Num());
+    const ovrResult StaleResult =
+        FMetaXRAcousticContainer::ReadGeometry(Geometry, StaleSerializer.GetSerializer(), nullptr, TEXT("Rebaked"));
+    OVR_AUDIO_TEST(StaleResult, Context);
+
+    // Instanced prototypes and distant levels ride along after the geometry data
+    FMetaXRAcousticGeometrySections Sections;
+    FMetaXRAcousticPrototype& Prototype = Sections.Prototypes.AddDefaulted_GetRef();
+    Prototype.MeshData = Serializer.Data;
+    Prototype.Transforms.Add(FMatrix44f::Identity);
+    Prototype.Transforms.Add(FMatrix44f(FTranslationMatrix(FVector(100.0, 0.0, 0.0))));
+    FMetaXRAcousticDistantLevel& Level = Sections.DistantLevels.AddDefaulted_GetRef();
+    Level.Distance = 1000.0f;
+    Level.MeshData = Serializer.Data;
+    Sections.Bounds = FBox3f(FVector3f(-1.0f), FVector3f(1.0f));
+    TArray<uint8> SectionContainer;
+    FMetaXRAcousticGeometrySections ReadSections;
+    if (!FMetaXRAcousticContainer::Compress(
+            Serializer.Data.GetData(), Serializer.Data.Num(), TEXT("ApiCalls"), SectionContainer, Sections)) {
+      UE_LOG(LogMetaXRAudio, Error, TEXT("Failed to compress geometry sections into an acoustic container"));
+      IsTestSuccessful = false;
+    }
+    FMetaXRAudioMemorySerializer SectionSerializer(SectionContainer.GetData(), SectionContainer.Num());
+    OVR_AUDIO_TEST(FMetaXRAcousticContainer::ReadGeometry(Geometry, SectionSerializer.GetSerializer(), &ReadSections), Context);
+    if (ReadSections.Prototypes.Num() != 1 || ReadSections.Prototypes[0].MeshData != Prototype.MeshData ||
+        ReadSections.Prototypes[0].Transforms != Prototype.Transforms || ReadSections.DistantLevels.Num() != 1 ||
+        ReadSections.DistantLevels[0].Distance != Level.Distance || ReadSections.DistantLevels[0].MeshData != Level.MeshData ||
+        !ReadSections.Bounds.Equals(Sections.Bounds)) {
+      UE_LOG(LogMetaXRAudio, Error, TEXT("Geometry sections did not survive the acoustic container round trip"));
+      IsTestSuccessful = false;
+    }
+
     ovrAudioMeshSimplification Simplification;
     Simplification.thisSize = sizeof(ovrAudioMeshSimplification);
     Simplification.flags = ovrAudioMeshFlags_enableMeshSimplification;
@@ -395,4 +451,297 @@ bool FApiCallsTest::RunTest(const FString& Parameters) {
 
   return IsTestSuccessful;
 }
+
+/*
+ * ------------------ Morton layout benchmark--------------------------
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMortonLayoutBenchmark,
+    "MetaXRAudio.Benchmarks.MortonLayout",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+// Corners are numbered by their X, Y and Z bits
+static constexpr uint32 BenchmarkBoxTriangles[36] = {0, 4, 6, 0, 6, 2, 1, 3, 7, 1, 7, 5, 0, 1, 5, 0, 5, 4,
+                                                     2, 6, 7, 2, 7, 3, 0, 2, 3, 0, 3, 1, 4, 5, 7, 4, 7, 6};
+
+// Boxes placed on a lattice in random order, the way traversal order scatters the meshes of a level
+static void BuildScatteredBoxes(const int32 BoxesPerSide, TArray<FVector3f>& OutVertices, TArray<uint32>& OutIndices) {
+  TArray<FIntVector> Cells;
+  for (int32 Z = 0; Z < BoxesPerSide; Z++) {
+    for (int32 Y = 0; Y < BoxesPerSide; Y++) {
+      for (int32 X = 0; X < BoxesPerSide; X++)
+        Cells.Add(FIntVector(X, Y, Z));
+    }
+  }
+  FRandomStream Random(0x5eed);
+  for (int32 Index = Cells.Num() - 1; Index > 0; Index--)
+    Cells.Swap(Index, Random.RandRange(0, Index));
+
+  for (const FIntVector& Cell : Cells) {
+    const uint32 FirstVertex = OutVertices.Num();
+    for (int32 Corner = 0; Corner < 8; Corner++)
+      OutVertices.Add(FVector3f(Cell) + 0.5f * FVector3f(Corner & 1, (Corner >> 1) & 1, Corner >> 2));
+    for (const uint32 Corner : BenchmarkBoxTriangles)
+      OutIndices.Add(FirstVertex + Corner);
+  }
+}
+
+// The corner positions of each triangle, in an order that doesn't depend on the order of the faces or vertices
+static TArray<TArray<FVector3f>> GetSortedTrianglePositions(const TArray<FVector3f>& Vertices, const TArray<uint32>& Indices) {
+  TArray<TArray<FVector3f>> Triangles;
+  for (int32 Index = 0; Index + 2 < Indices.Num(); Index += 3)
+    Triangles.Add({Vertices[Indices[Index]], Vertices[Indices[Index + 1]], Vertices[Indices[Index + 2]]});
+  Algo::Sort(Triangles, [](const TArray<FVector3f>& A, const TArray<FVector3f>& B) {
+    for (int32 Corner = 0; Corner < 3; Corner++) {
+      for (int32 Axis = 0; Axis < 3; Axis++) {
+        if (A[Corner][Axis] != B[Corner][Axis])
+          return A[Corner][Axis] < B[Corner][Axis];
+      }
+    }
+    return false;
+  });
+  return Triangles;
+}
+
+// Checks the sorted faces follow the Morton curve and each keeps its corner positions and winding
+static bool IsMortonLayout(
+    const TArray<FVector3f>& Vertices,
+    const TArray<uint32>& Indices,
+    const TArray<FVector3f>& SortedVertices,
+    const TArray<uint32>& SortedIndices) {
+  const FBox3f Bounds(SortedVertices);
+  uint32 PreviousCode = 0;
+  for (int32 Index = 0; Index + 2 < SortedIndices.Num(); Index += 3) {
+    const FVector3f Centroid =
+        (SortedVertices[SortedIndices[Index]] + SortedVertices[SortedIndices[Index + 1]] + SortedVertices[SortedIndices[Index + 2]]) / 3;
+    const uint32 Code = MetaXRAcousticMeshLayout::GetMortonCode(Centroid, Bounds);
+    if (Code < PreviousCode)
+      return false;
+    PreviousCode = Code;
+  }
+  return GetSortedTrianglePositions(Vertices, Indices) == GetSortedTrianglePositions(SortedVertices, SortedIndices);
+}
+
+struct FLayoutTimings {
+  double UploadSeconds = TNumericLimits<double>::Max();
+  double WriteSeconds = TNumericLimits<double>::Max();
+  int32 CompressedSize = 0;
+};
+
+// Best of several runs of the work a bake does with the mesh: simplify, serialize, compress
+static bool MeasureLayout(
+    ovrAudioContext Context,
+    const TArray<FVector3f>& Vertices,
+    const TArray<uint32>& Indices,
+    const ovrAudioMeshGroup& MeshGroup,
+    FLayoutTimings& OutTimings) {
+  ovrAudioMeshSimplification Simplification{};
+  Simplification.thisSize = sizeof(ovrAudioMeshSimplification);
+  Simplification.flags = ovrAudioMeshFlags_enableMeshSimplification;
+  Simplification.unitScale = 1;
+  Simplification.maxError = 0.1f;
+  Simplification.minDiffractionEdgeAngle = 1.0f;
+  Simplification.minDiffractionEdgeLength = 0.01f;
+  Simplification.flagLength = 1.0f;
+  Simplification.threadCount = 0;
+
+  for (int32 Run = 0; Run < 3; Run++) {
+    ovrAudioGeometry Geometry = nullptr;
+    if (OVRA_CALL(ovrAudio_CreateAudioGeometry)(Context, &Geometry) != ovrSuccess)
+      return false;
+
+    const double UploadStart = FPlatformTime::Seconds();
+    ovrResult Result = OVRA_CALL(ovrAudio_AudioGeometryUploadSimplifiedMeshArrays)(
+        Geometry,
+        Vertices.GetData(),
+        0,
+        Vertices.Num(),
+        0,
+        ovrAudioScalarType_Float32,
+        Indices.GetData(),
+        0,
+        Indices.Num(),
+        ovrAudioScalarType_UInt32,
+        &MeshGroup,
+        1,
+        &Simplification);
+    const double WriteStart = FPlatformTime::Seconds();
+    TArray<uint8> MeshData;
+    FMetaXRAudioArraySerializer Writer(MeshData);
+    const ovrAudioSerializer Serializer = Writer.GetSerializer();
+    if (Result == ovrSuccess)
+      Result = OVRA_CALL(ovrAudio_AudioGeometryWriteMeshData)(Geometry, &Serializer);
+    const double WriteEnd = FPlatformTime::Seconds();
+    OVRA_CALL(ovrAudio_DestroyAudioGeometry)(Geometry);
+
+    TArray<uint8> Container;
+    if (Result != ovrSuccess || !FMetaXRAcousticContainer::Compress(MeshData.GetData(), MeshData.Num(), TEXT("Benchmark"), Container))
+      return false;
+
+    OutTimings.UploadSeconds = FMath::Min(OutTimings.UploadSeconds, WriteStart - UploadStart);
+    OutTimings.WriteSeconds = FMath::Min(OutTimings.WriteSeconds, WriteEnd - WriteStart);
+    OutTimings.CompressedSize = Container.Num();
+  }
+  return true;
+}
+
+bool FMortonLayoutBenchmark::RunTest(const FString& Parameters) {
+  ovrAudioContextConfiguration Config{};
+  Config.acc_Size = sizeof(Config);
+  Config.acc_SampleRate = 48000;
+  Config.acc_BufferLength = 512;
+  Config.acc_MaxNumSources = 16;
+  ovrAudioContext Context = nullptr;
+  if (OVRA_CALL(ovrAudio_CreateContext)(&Context, &Config) != ovrSuccess) {
+    AddError(TEXT("Failed to create an audio context"));
+    return false;
+  }
+
+  TArray<FVector3f> ScatteredVertices;
+  TArray<uint32> ScatteredIndices;
+  BuildScatteredBoxes(16, ScatteredVertices, ScatteredIndices);
+  TArray<ovrAudioMeshGroup> MeshGroups;
+  ovrAudioMeshGroup& MeshGroup = MeshGroups.AddZeroed_GetRef();
+  MeshGroup.faceCount = ScatteredIndices.Num() / 3;
+  MeshGroup.faceType = ovrAudioFaceType_Triangles;
+
+  TArray<FVector3f> SortedVertices = ScatteredVertices;
+  TArray<uint32> SortedIndices = ScatteredIndices;
+  const double SortStart = FPlatformTime::Seconds();
+  MetaXRAcousticMeshLayout::SortMorton(SortedVertices, SortedIndices, MeshGroups);
+  const double SortSeconds = FPlatformTime::Seconds() - SortStart;
+
+  if (SortedIndices.Num() != ScatteredIndices.Num() || SortedVertices.Num() != ScatteredVertices.Num() ||
+      !IsMortonLayout(ScatteredVertices, ScatteredIndices, SortedVertices, SortedIndices)) {
+    OVRA_CALL(ovrAudio_DestroyContext)(Context);
+    AddError(TEXT("The Morton sort reordered the mesh incorrectly"));
+    return false;
+  }
+
+  FLayoutTimings Scattered;
+  FLayoutTimings Sorted;
+  const bool bMeasured = MeasureLayout(Context, ScatteredVertices, ScatteredIndices, MeshGroup, Scattered) &&
+      MeasureLayout(Context, SortedVertices, SortedIndices, MeshGroup, Sorted);
+  OVRA_CALL(ovrAudio_DestroyContext)(Context);
+  if (!bMeasured) {
+    AddError(TEXT("Failed to simplify and serialize the benchmark mesh"));
+    return false;
+  }
+
+  AddInfo(FString::Printf(TEXT("%i triangles, Morton sort took %.2f ms"), ScatteredIndices.Num() / 3, SortSeconds * 1000.0));
+  AddInfo(FString::Printf(
+      TEXT("Traversal order: upload %.2f ms, write %.2f ms, compressed %i bytes"),
+      Scattered.UploadSeconds * 1000.0,
+      Scattered.WriteSeconds * 1000.0,
+      Scattered.CompressedSize));
+  AddInfo(FString::Printf(
+      TEXT("Morton order: upload %.2f ms, write %.2f ms, compressed %i bytes"),
+      Sorted.UploadSeconds * 1000.0,
+      Sorted.WriteSeconds * 1000.0,
+      Sorted.CompressedSize));
+  return true;
+}
+
+/*
+ * ------------------ Heightfield decimation test--------------------------
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FHeightfieldDecimationTest,
+    "MetaXRAudio.HeightfieldDecimation",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+// Checks the triangles cover the Size x Size grid once and that every edge inside it is shared by two triangles
+static bool IsWatertightCover(const TArray<FVector3f>& Vertices, const TArray<uint32>& Indices, const int32 Size) {
+  double Area = 0.0;
+  TSet<TPair<uint32, uint32>> Edges;
+  for (int32 Index = 0; Index < Indices.Num(); Index += 3) {
+    const FVector3f& A = Vertices[Indices[Index]];
+    const FVector3f& B = Vertices[Indices[Index + 1]];
+    const FVector3f& C = Vertices[Indices[Index + 2]];
+    Area += 0.5 * ((C.X - A.X) * (B.Y - A.Y) - (C.Y - A.Y) * (B.X - A.X));
+    for (int32 Corner = 0; Corner < 3; Corner++)
+      Edges.Add(TPair<uint32, uint32>(Indices[Index + Corner], Indices[Index + (Corner + 1) % 3]));
+  }
+
+  for (const TPair<uint32, uint32>& Edge : Edges) {
+    if (Edges.Contains(TPair<uint32, uint32>(Edge.Value, Edge.Key)))
+      continue;
+    const FVector3f& A = Vertices[Edge.Key];
+    const FVector3f& B = Vertices[Edge.Value];
+    const bool bOnBorder = (A.X == B.X && (A.X == 0 || A.X == Size)) || (A.Y == B.Y && (A.Y == 0 || A.Y == Size));
+    if (!bOnBorder)
+      return false;
+  }
+  return FMath::IsNearlyEqual(Area, static_cast<double>(Size * Size));
+}
+
+bool FHeightfieldDecimationTest::RunTest(const FString& Parameters) {
+  constexpr int32 Size = 63;
+  TArray<float> Heights;
+  Heights.Init(100.0f, (Size + 1) * (Size + 1));
+
+  TArray<FVector3f> Vertices;
+  TArray<uint32> Indices;
+  MetaXRAcousticHeightfield::Decimate(Heights, Size, 1.0f, Vertices, Indices);
+  TestTrue(TEXT("Flat ground is covered without cracks"), IsWatertightCover(Vertices, Indices, Size));
+  TestTrue(TEXT("Flat ground keeps little more than its border"), Indices.Num() / 3 <= 4 * Size);
+
+  // A ridge across half the grid keeps its detail while the flat half stays coarse
+  for (int32 Y = 0; Y <= Size; Y++) {
+    for (int32 X = Size / 2; X <= Size; X++)
+      Heights[Y * (Size + 1) + X] = 100.0f + 20.0f * ((X * 7 + Y * 13) % 5);
+  }
+  MetaXRAcousticHeightfield::Decimate(Heights, Size, 1.0f, Vertices, Indices);
+  TestTrue(TEXT("Rough ground is covered without cracks"), IsWatertightCover(Vertices, Indices, Size));
+  TestTrue(TEXT("Rough ground is decimated"), Indices.Num() / 3 < 2 * Size * Size);
+  return true;
+}
+
+/*
+ * ------------------ Shared geometry cache test--------------------------
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FGeometryCacheTest,
+    "MetaXRAudio.GeometryCache",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FGeometryCacheTest::RunTest(const FString& Parameters) {
+  // A cache of its own, so the templates of a game running alongside are left alone
+  FMetaXRAcousticGeometryCache Cache;
+  const FString Key = TEXT("MetaXRAudio.GeometryCache/Door.xrageo");
+  int32 WokenCount = 0;
+  int32 RetryCount = 0;
+  const FMetaXRAcousticGeometryCache::FOnLoaded OnLoaded = [&](const FMetaXRAcousticGeometryCache::FTemplatePtr& Template) {
+    WokenCount++;
+    RetryCount += Template.IsValid() ? 0 : 1;
+  };
+
+  // The first instance reads the file while the others wait on it
+  bool bShouldLoad = false;
+  TestFalse(TEXT("Nothing is cached up front"), Cache.Find(Key, OnLoaded, bShouldLoad).IsValid());
+  TestTrue(TEXT("The first instance reads the file"), bShouldLoad);
+  for (int32 Index = 0; Index < 3; Index++) {
+    Cache.Find(Key, OnLoaded, bShouldLoad);
+    TestFalse(TEXT("Later instances wait for the first read"), bShouldLoad);
+  }
+
+  // A cancelled read sends the waiting instances back to the file, and the next one to ask reads it
+  Cache.Finish(Key, nullptr);
+  TestEqual(TEXT("Waiting instances are told to read the file themselves"), RetryCount, 3);
+  Cache.Find(Key, OnLoaded, bShouldLoad);
+  TestTrue(TEXT("A cancelled read is started again"), bShouldLoad);
+  Cache.Find(Key, OnLoaded, bShouldLoad);
+
+  const TSharedRef<FMetaXRAcousticGeometryCache::FTemplate, ESPMode::ThreadSafe> Template =
+      MakeShared<FMetaXRAcousticGeometryCache::FTemplate, ESPMode::ThreadSafe>();
+  Template->MeshData.Init(7, 64);
+  Cache.Finish(Key, Template);
+  TestEqual(TEXT("Waiting instances get the template"), WokenCount - RetryCount, 1);
+  const FMetaXRAcousticGeometryCache::FTemplatePtr Cached = Cache.Find(Key, OnLoaded, bShouldLoad);
+  TestTrue(TEXT("Later instances clone the cached template"), Cached.IsValid() && Cached->MeshData == Template->MeshData && !bShouldLoad);
+
+  Cache.Empty();
+  TestFalse(TEXT("Emptying drops the template"), Cache.Find(Key, OnLoaded, bShouldLoad).IsValid());
+  return true;
+}
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,51 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Serialization/BulkData.h"
+
+#include "MetaXRAcousticBakedData.generated.h"
+
+/*
+ * Wraps a baked acoustic geometry (.xrageo) or acoustic map (.xramap) blob in bulk data so it is packaged and streamed with the
+ * level that references it instead of being read as a loose Content file.
+ */
+UCLASS(BlueprintType, meta = (DisplayName = "Meta XR Acoustic Baked Data"))
+class METAXRAUDIO_API UMetaXRAcousticBakedData final : public UDataAsset {
+  GENERATED_BODY()
+
+ public:
+  // The loose baked file the payload is taken from, relative to the project's Content directory
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics")
+  FString SourceFilePath;
+
+  void Serialize(FArchive& Ar) final;
+#if WITH_EDITOR
+  void PreSave(FObjectPreSaveContext ObjectSaveContext) final;
+  // Copy the current contents of SourceFilePath into the payload
+  bool RefreshFromSourceFile();
+  // Called from the PreSave of a component with a baked file. When "Cook Baked Data Into Levels" is on and the component's
+  // package is being cooked, moves the contents of FilePath into a payload of Owner's own for that save only. The payload is taken
+  // off Owner again once its package is saved, so the editor's component never keeps it ahead of a later rebake.
+  static void AttachForCook(
+      UObject* Owner,
+      const FString& FilePath,
+      TObjectPtr<UMetaXRAcousticBakedData>& BakedData,
+      const FObjectPreSaveContext& ObjectSaveContext);
+#endif
+
+  bool HasPayload() const {
+    return BulkData.GetBulkDataSize() > 0;
+  }
+  int64 GetPayloadSize() const {
+    return BulkData.GetBulkDataSize();
+  }
+
+  // Runs Reader over a read-only view of the payload. Safe to call from worker threads.
+  bool ReadPayload(TFunctionRef<bool(const uint8* Data, int64 Size)> Reader) const;
+
+ private:
+  FByteBulkData BulkData;
+};
@@ -7,7 +7,6 @@
 #include "DebugRenderSceneProxy.h"
 #include "DynamicMeshBuilder.h"
 #include "HAL/CriticalSection.h"
-#include "LandscapeInfo.h"
 #include "MetaXR_Audio.h"
 #include "MetaXR_Audio_AcousticRayTracing.h"
 
@@ -15,9 +14,22 @@
 
 // Fwd declare
 class UMetaXRAcousticMaterialProperties;
+class UMetaXRAcousticBakedData;
 class UMetaXRAcousticGeometry;
 class FAcousticGeoGizmoData;
 class FMetaXRAcousticGeometrySceneProxy;
+class FMetaXRAcousticMaterialRefs;
+class ULandscapeHeightfieldCollisionComponent;
+struct FAcousticGeometryAsyncLoad;
+struct FAcousticGeometryAsyncUpload;
+struct FAcousticGeometryInstances;
+struct FAcousticGeometryLandscapeBuild;
+struct FAcousticGeometryLandscapeTiles;
+struct FAcousticGeometryLevels;
+struct FMetaXRAcousticGeometrySections;
+struct FMetaXRAcousticPrototype;
+struct FMeshSubmission;
+struct FMeshUploadOptions;
 
 // Custom deleter for FAcousticGeoGizmoData
 struct FAcousticGeoGizmoDataDeleter {
@@ -32,6 +44,46 @@ typedef uint32_t MetaXRAudioMeshFlags;
 UENUM(BlueprintType)
 enum class ETraversalMode : uint8 { Default, Actor, SceneComponent };
 
+// Which representation of each static mesh the acoustic geometry is built from
+UENUM(BlueprintType)
+enum class EMetaXRAcousticGeometrySource : uint8 {
+  // The render mesh of the selected LOD
+  RenderMesh,
+  // The boxes, spheres, capsules and convex hulls of each mesh's simple collision. Meshes without simple collision use their
+  // render mesh.
+  SimpleCollision
+};
+
+// How the instances of hierarchical instanced static meshes (e.g. foliage) are represented in the acoustic geometry
+UENUM(BlueprintType)
+enum class EMetaXRAcousticInstanceProxy : uint8 {
+  // Every instance contributes its full mesh
+  None,
+  // Every instance is replaced by its oriented bounding box
+  InstanceBox,
+  // Instances are grouped on a grid and each occupied cell is replaced by the box around its instances
+  ClusterBox,
+  // Every instance is replaced by the convex hulls, boxes, spheres and capsules of its mesh's simple collision. Instances of meshes
+  // without simple collision use their oriented bounding box.
+  InstanceCollision
+};
+
+// A coarser simplification baked alongside the geometry and swapped in while the listener is far away
+USTRUCT(BlueprintType)
+struct FMetaXRAcousticErrorLevel {
+  GENERATED_BODY()
+
+  // Maximum tolerable mesh simplification error of this level in centimeters
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics", meta = (ClampMin = "0.0"))
+  float MaxError = 50.0f;
+
+  // Distance in centimeters between the listener and the geometry's bounds beyond which this level is used
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics", meta = (ClampMin = "0.0"))
+  float Distance = 2000.0f;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMetaXRAcousticGeometryReady, UMetaXRAcousticGeometry*, Geometry);
+
 UCLASS(
     ClassGroup = (Audio),
     HideCategories = (Activation, Collision, Cooking),
@@ -59,10 +111,97 @@ class METAXRAUDIO_API UMetaXRAcousticGeometry final : public UPrimitiveComponent
   UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics")
   ETraversalMode TraversalMode = ETraversalMode::Default;
 
+  // Build the acoustic mesh from render meshes, or from the much cheaper simple collision authored for physics
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics")
+  EMetaXRAcousticGeometrySource GeometrySource = EMetaXRAcousticGeometrySource::RenderMesh;
+
   // Maximum tolerable mesh simplification error in centimeters
   UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics")
   float MaxError = 10.0f;
 
+  // Coarser simplifications baked into the same file. At runtime the level whose distance the listener is beyond replaces the
+  // geometry, so far away rooms cost the propagation engine less.
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics")
+  TArray<FMetaXRAcousticErrorLevel> DistantErrorLevels;
+
+  // How many centimeters nearer than a level's distance the listener has to come before switching back to the finer level
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics", AdvancedDisplay, meta = (ClampMin = "0.0"))
+  float ErrorLevelHysteresis = 200.0f;
+
+  // Weld nearby vertices and drop collapsed and repeated faces before simplification, which shrinks the simplifier's input
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics", AdvancedDisplay)
+  bool bCleanMesh = true;
+
+  // Vertices closer than this many centimeters are welded together when cleaning the mesh. At 0 only exact duplicates are welded.
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintReadOnly,
+      Category = "Acoustics",
+      AdvancedDisplay,
+      meta = (ClampMin = "0.0", EditCondition = "bCleanMesh"))
+  float WeldTolerance = 0.1f;
+
+  // Drop faces no sound can reach before simplification, such as faces buried inside other meshes or the undersides of floor
+  // tiles. Reachable space is flood filled from outside the geometry, from the level's player starts and from Reachability
+  // Seeds, so rooms sealed off from all of those lose their inner faces.
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics", AdvancedDisplay)
+  bool bCullInteriorFaces = false;
+
+  // Edge length in centimeters of the voxels reachable space is flood filled through. Openings narrower than this count as closed.
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintReadOnly,
+      Category = "Acoustics",
+      AdvancedDisplay,
+      meta = (ClampMin = "1.0", EditCondition = "bCullInteriorFaces"))
+  float InteriorCullVoxelSize = 20.0f;
+
+  // Replace the gathered meshes with a watertight shell around the space they fill, built on a voxel grid and then simplified
+  // as usual. The triangle count follows the voxel resolution rather than the source meshes, which suits cluttered interiors such
+  // as scaffolding and machinery. Each shell face keeps the acoustic material that covers the most of its voxel.
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics", AdvancedDisplay)
+  bool bVoxelShell = false;
+
+  // Edge length in centimeters of the voxels the shell is built on. Gaps narrower than this are closed over.
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintReadOnly,
+      Category = "Acoustics",
+      AdvancedDisplay,
+      meta = (ClampMin = "1.0", EditCondition = "bVoxelShell"))
+  float VoxelShellSize = 25.0f;
+
+  // Extra points listeners can reach, relative to this component, e.g. inside closed rooms without a player start
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintReadOnly,
+      Category = "Acoustics",
+      AdvancedDisplay,
+      meta = (EditCondition = "bCullInteriorFaces || bVoxelShell"))
+  TArray<FVector> ReachabilitySeeds;
+
+  // Use this component's Min Mesh Size and Min Mesh Size Error Ratio instead of the project's
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics", AdvancedDisplay)
+  bool bOverrideSignificance = false;
+
+  // Static meshes whose bounds are smaller than this many centimeters along every axis are left out of the geometry. 0 keeps every mesh.
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintReadOnly,
+      Category = "Acoustics",
+      AdvancedDisplay,
+      meta = (ClampMin = "0.0", EditCondition = "bOverrideSignificance"))
+  float MinMeshSize = 0.0f;
+
+  // Static meshes whose bounds are smaller than this multiple of Max Error along every axis are left out of the geometry
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintReadOnly,
+      Category = "Acoustics",
+      AdvancedDisplay,
+      meta = (ClampMin = "0.0", EditCondition = "bOverrideSignificance"))
+  float MinMeshSizeErrorRatio = 0.0f;
+
   // Which LOD to use for the acoustic geometry when using an LOD Group. The lowest value of 0 corresponds to the highest quality mesh.
   UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics")
   int32 LOD = 0;
@@ -75,6 +214,38 @@ class METAXRAUDIO_API UMetaXRAcousticGeometry final : public UPrimitiveComponent
   UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics")
   bool bFileEnabled = true;
 
+  // Optional packaged copy of the geometry file. When set it is loaded with the level instead of reading the loose file.
+  // Created automatically at cook time when "Cook Baked Data Into Levels" is enabled in the project settings.
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics", AdvancedDisplay)
+  TObjectPtr<UMetaXRAcousticBakedData> BakedData;
+
+  // Simplify each distinct instanced static mesh once and place that result per instance, rather than merging and
+  // simplifying a copy of every instance. Much faster for heavily instanced foliage and props.
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics", AdvancedDisplay)
+  bool bSimplifyInstancesOnce = false;
+
+  // Represent hierarchical instanced static meshes such as foliage with coarse boxes or their simple collision instead of a copy of
+  // the mesh per instance, so the triangle count follows the number of instances or clusters rather than the mesh complexity
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics")
+  EMetaXRAcousticInstanceProxy InstanceProxy = EMetaXRAcousticInstanceProxy::None;
+
+  // Edge length in centimeters of the grid cells instances are clustered into
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintReadOnly,
+      Category = "Acoustics",
+      meta = (ClampMin = "10.0", EditCondition = "InstanceProxy == EMetaXRAcousticInstanceProxy::ClusterBox"))
+  float InstanceProxyClusterSize = 500.0f;
+
+  // Acoustic material of the instance proxies. When none is set each proxy keeps the acoustic material of the mesh it stands in
+  // for, or the Foliage preset when that mesh has none.
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintReadOnly,
+      Category = "Acoustics",
+      meta = (EditCondition = "InstanceProxy != EMetaXRAcousticInstanceProxy::None"))
+  TObjectPtr<UMetaXRAcousticMaterialProperties> InstanceProxyMaterial;
+
   // Flags that indicate how the geometry mesh should be simplified to create an acoustic mesh
   UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics")
   int32 MeshFlags = ovrAudioMeshFlags_enableMeshSimplification;
@@ -87,6 +258,59 @@ class METAXRAUDIO_API UMetaXRAcousticGeometry final : public UPrimitiveComponent
   UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics")
   FString HierarchyHash;
 
+  // Set when the file was baked without the hierarchy's landscapes, which are built as tiles at startup instead. Files baked
+  // before still hold their landscapes, so no tiles are built for them until they are rebaked, and the editor flags them for it.
+  UPROPERTY()
+  bool bFileExcludesLandscapes = false;
+
+  // Set when "Bake Acoustic Geometry Chunks" merged this geometry's meshes into the level's geometry chunks. The chunks carry it
+  // at runtime, so it no longer loads its own file.
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Acoustics", AdvancedDisplay)
+  bool bMergedIntoChunk = false;
+
+  // Hand this geometry's handle to the next spawn of its actor when it despawns, rather than destroying it and building a new one,
+  // for frequently spawned actors such as projectiles and debris. Handles are shared by source and settings: the geometry file,
+  // or when built at startup the actor class along with the meshes, materials and relative placements it gathers.
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics", AdvancedDisplay)
+  bool bPoolGeometry = false;
+
+  // Most idle handles of this geometry kept for later spawns
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintReadOnly,
+      Category = "Acoustics",
+      AdvancedDisplay,
+      meta = (ClampMin = "1", EditCondition = "bPoolGeometry"))
+  int32 PoolSize = 8;
+
+  // Broadcast on the game thread once the geometry has been loaded and is live in the acoustic simulation
+  UPROPERTY(BlueprintAssignable, Category = "Acoustics")
+  FOnMetaXRAcousticGeometryReady OnGeometryReady;
+
+  // True once the geometry has been loaded (or uploaded) and is live in the acoustic simulation
+  UFUNCTION(BlueprintPure, Category = "Acoustics")
+  bool IsGeometryReady() const {
+    return bGeometryReady;
+  }
+
+  // Landscapes in the hierarchy get one acoustic geometry per collision component, built on a worker at startup from the collision
+  // heightfield. Enables or disables the tile of the component at SectionBase, e.g. as the world streams.
+  UFUNCTION(BlueprintCallable, Category = "Acoustics")
+  void SetLandscapeTileEnabled(FIntPoint SectionBase, bool bEnabled);
+
+  UFUNCTION(BlueprintPure, Category = "Acoustics")
+  int32 GetLandscapeTileCount() const;
+
+  // Starts parsing this geometry's file on workers into the handles the geometry pool lacks to have Count (at most Pool Size)
+  // idle, and returns how many are being built. The file is read once, through the geometry cache. Called on the component
+  // templates of the project's Prewarmed Geometry Pools as a level starts.
+  int32 PrewarmPool(UWorld* World, int32 Count);
+
+  // Waits for the movable geometry uploads and file loads still running for components that stopped waiting for them, and for
+  // pool prewarms still parsing, and destroys their handles. Called as worlds are cleaned up and the module shuts down, before
+  // the context the handles belong to goes away.
+  static void FlushAbandonedWork();
+
 #if WITH_EDITOR
   void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) final;
   bool NeedsRebake() const {
@@ -95,6 +319,8 @@ class METAXRAUDIO_API UMetaXRAcousticGeometry final : public UPrimitiveComponent
   static const bool IsValidAcousticGeoFilePath(const FString& FilePath);
   FPrimitiveSceneProxy* CreateSceneProxy() final;
   FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const final;
+  // Simplifies the geometry at InMaxError the way it is baked and counts the resulting triangles, instances included
+  bool CountSimplifiedTriangles(float InMaxError, int32& OutTriangleCount);
 #endif
 #if WITH_EDITORONLY_DATA
   void OnObjectSelected(UObject* Object);
@@ -106,7 +332,7 @@ class METAXRAUDIO_API UMetaXRAcousticGeometry final : public UPrimitiveComponent
   bool ReadFile();
   bool WriteFile();
   FString ComputeHash() const;
-  bool WriteFileInternal(ovrAudioGeometry GeometryHandle);
+  bool WriteFileInternal(ovrAudioGeometry GeometryHandle, const FMetaXRAcousticGeometrySections* Sections = nullptr);
   bool IncludesChildren() const {
     return bIncludeChildren;
   }
@@ -128,6 +354,10 @@ class METAXRAUDIO_API UMetaXRAcousticGeometry final : public UPrimitiveComponent
   FString GetFilePath() const {
     return FilePath;
   }
+  bool IsMergedIntoChunk() const {
+    return bMergedIntoChunk;
+  }
+  bool IsStatic() const;
 
   // Structures
   struct METAXRAUDIO_API FMeshMaterial {
@@ -146,10 +376,15 @@ class METAXRAUDIO_API UMetaXRAcousticGeometry final : public UPrimitiveComponent
   };
 
   struct METAXRAUDIO_API FLandscapeMaterial {
-    ULandscapeInfo* LandscapeInfo = nullptr;
+    // The collision components of the landscape and its streaming proxies
+    TArray<ULandscapeHeightfieldCollisionComponent*> Tiles;
     TArray<UMetaXRAcousticMaterialProperties*> Materials;
   };
 
+  // Gathers the static meshes of this geometry's own hierarchy with its gather settings, for merging into a geometry chunk.
+  // Returns false if the hierarchy includes landscapes, which can't be chunked.
+  bool GatherChunkableMeshes(TArray<FMeshMaterial>& OutMeshes) const;
+
   // Define visitor class skeleton and declare the implementations
   class METAXRAUDIO_API ITransformVisitor {
    public:
@@ -187,6 +422,9 @@ class METAXRAUDIO_API UMetaXRAcousticGeometry final : public UPrimitiveComponent
 
     FString GetHash() const;
     bool IsStale() const;
+    bool HasLandscapes() const {
+      return bHasLandscapes;
+    }
 
    private:
     TArray<UMetaXRAcousticMaterialProperties*> VisitActor(
@@ -202,6 +440,7 @@ class METAXRAUDIO_API UMetaXRAcousticGeometry final : public UPrimitiveComponent
     FDateTime TimeStamp;
     bool bUsePhysicalMaterials;
     bool bIsOlder = false;
+    bool bHasLandscapes = false;
     FString Hash;
   };
 
@@ -226,7 +465,13 @@ class METAXRAUDIO_API UMetaXRAcousticGeometry final : public UPrimitiveComponent
 
   class METAXRAUDIO_API FMeshGatherer final : public ITransformVisitor {
    public:
-    FMeshGatherer(const bool IgnoreStatic, const bool UsePhysicalMaterials, const bool bShouldIncludeChildren, const int LODSelection = 0);
+    // Meshes whose bounds are smaller than InMinMeshSize centimeters along every axis are skipped
+    FMeshGatherer(
+        const bool IgnoreStatic,
+        const bool UsePhysicalMaterials,
+        const bool bShouldIncludeChildren,
+        const int LODSelection = 0,
+        const float InMinMeshSize = 0.0f);
 
     const TArray<UMetaXRAcousticGeometry::FLandscapeMaterial>& GetTerrains() const {
       return Terrains;
@@ -237,6 +482,12 @@ class METAXRAUDIO_API UMetaXRAcousticGeometry final : public UPrimitiveComponent
     int GetLODSelection() const {
       return LodSelection;
     }
+    int GetSkippedMeshCount() const {
+      return SkippedMeshCount;
+    }
+    void AddMeshes(const TArray<UMetaXRAcousticGeometry::FMeshMaterial>& InMeshes) {
+      Meshes.Append(InMeshes);
+    }
 
    private:
     TArray<UMetaXRAcousticMaterialProperties*> VisitActor(
@@ -247,13 +498,16 @@ class METAXRAUDIO_API UMetaXRAcousticGeometry final : public UPrimitiveComponent
         const TArray<UMetaXRAcousticMaterialProperties*>* UserData) final;
 
     void CollectTerrains(const AActor* Actor, const TArray<UMetaXRAcousticMaterialProperties*>& MaterialsToApply);
+    bool IsSignificant(const UStaticMeshComponent* MeshComponent);
 
    private:
     const bool bIgnoreStatic;
     const bool bUsePhysicalMaterials = false;
     const int LodSelection = 0;
+    const float MinMeshSize = 0.0f;
 
     int IgnoredMeshCount = 0;
+    int SkippedMeshCount = 0;
     TArray<UMetaXRAcousticGeometry::FLandscapeMaterial> Terrains;
     TArray<UMetaXRAcousticGeometry::FMeshMaterial> Meshes;
   };
@@ -277,16 +531,60 @@ class METAXRAUDIO_API UMetaXRAcousticGeometry final : public UPrimitiveComponent
   void GenerateFileNameIfEmpty();
   void RefreshNeedsRebaked();
   void OnComponentCreated() final;
+  void PreSave(FObjectPreSaveContext ObjectSaveContext) final;
 #endif
 
   bool CreatePropagationGeometry();
   bool DestroyPropagationGeometry();
   void TraverseHierarchy(ITransformVisitor& Visitor) const;
-  bool UploadMesh(ovrAudioGeometry GeometryHandle);
-  bool UploadMesh(ovrAudioGeometry GeometryHandle, AActor* Owner, bool IgnoreStatic, int& OutIgnoredMeshCount);
+  void TraverseChunkSources(ITransformVisitor& Visitor) const;
+  void GatherChunkMeshes(FMeshGatherer& Gatherer) const;
+  bool UploadMesh(ovrAudioGeometry GeometryHandle, TArray<FMetaXRAcousticPrototype>* OutPrototypes = nullptr);
+  bool UploadMesh(
+      ovrAudioGeometry GeometryHandle,
+      AActor* Owner,
+      bool IgnoreStatic,
+      int& OutIgnoredMeshCount,
+      TArray<FMetaXRAcousticPrototype>* OutPrototypes = nullptr);
+  // Gathers and stages the meshes for SubmitMesh, which no longer needs the game thread. Instanced meshes are simplified into
+  // OutPrototypes right away.
+  bool StageMesh(
+      bool IgnoreStatic,
+      bool bLiveGeometry,
+      FMetaXRAcousticMaterialRefs& MaterialRefs,
+      FMeshSubmission& OutSubmission,
+      int& OutIgnoredMeshCount,
+      TArray<FMetaXRAcousticPrototype>* OutPrototypes);
+  void FinishGeometryUpload(const TSharedRef<FAcousticGeometryAsyncUpload>& Upload);
+  void CancelGeometryUpload();
+  bool CreateInstanceGeometries(TArray<FMetaXRAcousticPrototype>&& Prototypes);
+  void DestroyInstanceGeometries();
+  void SetInstancesEnabled(bool bEnabled);
+  bool BuildDistantLevels(FMetaXRAcousticGeometrySections& OutSections);
+  bool CreateGeometrySections(FMetaXRAcousticGeometrySections&& Sections);
+  bool CreateDistantLevels(FMetaXRAcousticGeometrySections&& Sections);
+  void DestroyDistantLevels();
+  bool CreateLandscapeTiles(bool bFileHoldsLandscapes);
+  void FinishLandscapeTiles(const TSharedRef<FAcousticGeometryLandscapeBuild>& Build);
+  void DestroyLandscapeTiles();
+  void SetLandscapeTilesEnabled(bool bEnabled);
+  void UpdateActiveLevel();
+  void SetGeometryEnabled(bool bEnabled);
+  FMeshUploadOptions GetMeshUploadOptions(bool bAllowPrototypes) const;
+  ovrAudioMeshSimplification GetMeshSimplification() const;
+  FString GetPoolKey() const;
+  bool CanReleaseToPool() const;
+  bool UsesSharedFile() const;
+  FString GetGeometryCacheKey() const;
+  TArray<FVector3f> GetReachabilitySeeds() const;
+  float GetMinMeshSize() const;
+  UMetaXRAcousticMaterialProperties* GetInstanceProxyMaterial(const TArray<UMetaXRAcousticMaterialProperties*>& MeshMaterials);
   void ApplyTransform();
   void LoadGeometryAsync();
-  bool IsStatic() const;
+  void FinishGeometryLoad(const TSharedRef<FAcousticGeometryAsyncLoad>& Load);
+  // Returns true when a read or parse in flight took over OvrGeometry, which the caller then must not destroy or reuse
+  bool CancelGeometryLoad();
+  void MarkGeometryReady();
   bool IsPlaymodeActive() const;
   void CheckGeoTransformValid();
 
@@ -294,6 +592,29 @@ class METAXRAUDIO_API UMetaXRAcousticGeometry final : public UPrimitiveComponent
   ovrAudioContext CachedContext;
   FTransform PreviousTransform;
   ovrAudioGeometry PreviousGeometry;
+  TSharedPtr<FAcousticGeometryAsyncLoad> PendingLoad;
+  // Simplification of a movable geometry running on a worker; OvrGeometry is swapped for its handle when it completes
+  TSharedPtr<FAcousticGeometryAsyncUpload> PendingUpload;
+  // The pool key the handle was acquired under, which it is released under again
+  FString PoolKey;
+  bool bGeometryReady = false;
+  // The geometry was uploaded straight from a mesh's render data, so its vertices are in UE axes rather than OVR axes
+  bool bMeshSpaceUpload = false;
+  // Static meshes left out of the last upload for being smaller than the significance threshold
+  int32 SkippedMeshCount = 0;
+  // References into the shared material pool held for as long as OvrGeometry exists
+  TArray<ovrAudioMaterial> PooledMaterials;
+  // Per-instance geometry handles placed from simplified-once prototypes
+  TSharedPtr<FAcousticGeometryInstances> Instances;
+  // Handles of the distant error levels loaded from the file, only one of which is enabled at a time
+  TSharedPtr<FAcousticGeometryLevels> Levels;
+  // Handles of the landscape tiles, one per landscape collision component
+  TSharedPtr<FAcousticGeometryLandscapeTiles> LandscapeTiles;
+  // Heights of the landscape tiles being sampled and decimated on a worker; LandscapeTiles is built from it when it completes
+  TSharedPtr<FAcousticGeometryLandscapeBuild> PendingLandscapeBuild;
+  // Foliage preset used for the instance proxies of meshes without an acoustic material when InstanceProxyMaterial is unset
+  UPROPERTY(Transient)
+  TObjectPtr<UMetaXRAcousticMaterialProperties> DefaultInstanceProxyMaterial;
 #if WITH_EDITOR
   mutable FCriticalSection GizmoUpdateCS;
   TUniquePtr<FAcousticGeoGizmoData, FAcousticGeoGizmoDataDeleter> GizmoData = nullptr;
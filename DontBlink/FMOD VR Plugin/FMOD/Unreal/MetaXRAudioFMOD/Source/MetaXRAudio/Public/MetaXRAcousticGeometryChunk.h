@@ -0,0 +1,55 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+#pragma once
+
+#include "GameFramework/Actor.h"
+#include "MetaXRAcousticGeometry.h"
+
+#include "MetaXRAcousticGeometryChunk.generated.h"
+
+// One fixed size cell of a level's merged static acoustic geometry. "Bake Acoustic Geometry Chunks" in the Build menu merges every
+// static, file enabled acoustic geometry of the level into these, so the propagation engine holds one geometry per occupied cell
+// instead of one per actor. The merged geometries stay in the level as the chunks' sources but no longer load their own files.
+UCLASS(
+    NotPlaceable,
+    ClassGroup = (Audio),
+    HideCategories = (Cooking, Physics, Networking, Input),
+    meta = (DisplayName = "Meta XR Acoustic Geometry Chunk"))
+class METAXRAUDIO_API AMetaXRAcousticGeometryChunk : public AActor {
+  GENERATED_BODY()
+
+ public:
+  AMetaXRAcousticGeometryChunk();
+
+  // Gathers the static meshes of the sources whose bounds are centered in this chunk's cell, each with its source's settings
+  void GatherMeshes(TArray<UMetaXRAcousticGeometry::FMeshMaterial>& OutMeshes) const;
+
+  const TArray<TObjectPtr<UMetaXRAcousticGeometry>>& GetSources() const {
+    return Sources;
+  }
+
+#if WITH_EDITOR
+  // Merges the static, file enabled acoustic geometry of the world's current level into chunks of the project's Geometry Chunk
+  // Size and bakes a file per chunk. Chunks from an earlier bake are reused by cell so their settings are kept. Geometry is only
+  // marked as merged once every chunk holding it was written; geometry in a chunk that failed keeps its own file.
+  static bool BakeLevel(UWorld* World);
+  // Deletes the chunks of the world's current level and returns their sources to loading their own files
+  static void RemoveFromLevel(UWorld* World);
+#endif
+
+  // The merged geometry, located at the center of the cell
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Acoustics")
+  TObjectPtr<UMetaXRAcousticGeometry> Geometry;
+
+  // Cell of the chunk grid this chunk covers
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Acoustics")
+  FIntVector Cell = FIntVector::ZeroValue;
+
+  // Edge length in centimeters of the chunk grid when this chunk was baked
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Acoustics")
+  float ChunkSize = 5000.0f;
+
+ private:
+  // Geometries with static meshes centered in the cell
+  UPROPERTY(VisibleAnywhere, Category = "Acoustics")
+  TArray<TObjectPtr<UMetaXRAcousticGeometry>> Sources;
+};
@@ -14,6 +14,7 @@
 // Fwd declare
 class UMetaXRAcousticMaterial;
 class UMetaXRAcousticGeometry;
+class UMetaXRAcousticBakedData;
 
 /*
  * MetaXRAudio geometry components are used to customize an a static mesh actor's acoustic properties.
@@ -62,6 +63,15 @@ class METAXRAUDIO_API UMetaXRAcousticMap final : public UPrimitiveComponent {
   UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics")
   FString FilePath;
 
+  // Optional packaged copy of the acoustic map file. When set it is loaded with the level instead of reading the loose file.
+  // Created automatically at cook time when "Cook Baked Data Into Levels" is enabled in the project settings.
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics", AdvancedDisplay)
+  TObjectPtr<UMetaXRAcousticBakedData> BakedData;
+
+  // Hash of the scene the acoustic map file was baked from. A compressed file baked from another scene is stale and isn't loaded.
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Acoustics", AdvancedDisplay)
+  FString SceneHash;
+
   // Only bake data for game objects marked as static when checked
   UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics")
   bool bStaticOnly = false;
@@ -119,6 +129,7 @@ class METAXRAUDIO_API UMetaXRAcousticMap final : public UPrimitiveComponent {
   void CancelCompute();
   FVector GetNewPointForRay(const FVector& EditorCameraPosition, const FVector& EditorCameraDirection) const;
   void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) final;
+  void PreSave(FObjectPreSaveContext ObjectSaveContext) final;
   bool IsComputeCanceled() const {
     return bComputeCanceled;
   }
@@ -163,6 +174,7 @@ class METAXRAUDIO_API UMetaXRAcousticMap final : public UPrimitiveComponent {
   FPrimitiveSceneProxy* CreateSceneProxy() final;
   void CheckMapTransformValid();
   void ApplyTransform();
+  void EnableLoadedMap();
   bool IsPlaymodeActive() const;
   void UpdateCachedPoints();
 
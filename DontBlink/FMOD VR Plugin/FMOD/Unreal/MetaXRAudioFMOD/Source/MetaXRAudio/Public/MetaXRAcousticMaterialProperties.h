@@ -91,7 +91,7 @@ class METAXRAUDIO_API UMetaXRAcousticMaterialProperties : public UDataAsset {
 
   void AppendHash(FString& hash) const;
 
-  void ConstructMaterial(ovrAudioMaterial Material);
+  void ConstructMaterial(ovrAudioMaterial Material) const;
 
   void ApplyPreset(EMetaXRAudioMaterialPreset NewPreset) {
     Data.ApplyPreset(NewPreset);
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "GameFramework/Actor.h"
 #include "MetaXR_Audio.h"
 
 #include "MetaXRAcousticProjectSettings.generated.h"
@@ -34,6 +35,46 @@ struct FMaterialLinkage {
   FSoftObjectPath PhysicalMaterial;
 };
 
+// The acoustic geometry triangle budget of one target platform, used when baking a level's geometry to a budget
+USTRUCT()
+struct FMetaXRAcousticTriangleBudget {
+  GENERATED_BODY()
+
+  // Name shown in the Build menu, e.g. "Quest 3"
+  UPROPERTY(EditDefaultsOnly, Category = "AcousticsSettings")
+  FString Platform;
+
+  // Total simplified triangles allowed across every file enabled acoustic geometry in a level
+  UPROPERTY(EditDefaultsOnly, Category = "AcousticsSettings", meta = (ClampMin = "1"))
+  int32 MaxTriangles = 100000;
+
+  // Smallest Max Error in centimeters the solver assigns to the most important geometry
+  UPROPERTY(EditDefaultsOnly, Category = "AcousticsSettings", meta = (ClampMin = "0.0"))
+  float MinMaxError = 1.0f;
+
+  // Largest Max Error in centimeters the solver assigns to the least important geometry
+  UPROPERTY(EditDefaultsOnly, Category = "AcousticsSettings", meta = (ClampMin = "0.0"))
+  float MaxMaxError = 200.0f;
+
+  // Distance in centimeters from playable space (the level's player starts) over which a geometry's importance halves
+  UPROPERTY(EditDefaultsOnly, Category = "AcousticsSettings", meta = (ClampMin = "1.0"))
+  float PlayableFalloff = 2000.0f;
+};
+
+// An actor class whose pooled acoustic geometry handles are built when a level starts, ahead of its first spawns
+USTRUCT()
+struct FMetaXRAcousticGeometryPoolPrewarm {
+  GENERATED_BODY()
+
+  // Only the file enabled acoustic geometry components of the class with "Pool Geometry" set are prewarmed
+  UPROPERTY(EditDefaultsOnly, Category = "AcousticsSettings")
+  TSoftClassPtr<AActor> ActorClass;
+
+  // Idle handles to build per geometry component, up to the component's Pool Size
+  UPROPERTY(EditDefaultsOnly, Category = "AcousticsSettings", meta = (ClampMin = "0"))
+  int32 Count = 4;
+};
+
 UCLASS(config = Game, defaultconfig, BlueprintType)
 class METAXRAUDIO_API UMetaXRAcousticProjectSettings : public UObject {
   GENERATED_BODY()
@@ -59,6 +100,21 @@ class METAXRAUDIO_API UMetaXRAcousticProjectSettings : public UObject {
   UPROPERTY(GlobalConfig, BlueprintReadWrite, EditAnywhere, Category = "AcousticsSettings")
   TArray<FString> ExcludeTags;
 
+  // Static meshes whose bounds are smaller than this many centimeters along every axis are left out of acoustic geometry, so
+  // cups, pens and decals don't need exclude tags. 0 keeps every mesh. Geometry components can override this.
+  UPROPERTY(GlobalConfig, BlueprintReadWrite, EditAnywhere, Category = "AcousticsSettings", meta = (ClampMin = "0.0"))
+  float MinMeshSize;
+
+  // Static meshes whose bounds are smaller than this multiple of their geometry's Max Error along every axis are left out of
+  // acoustic geometry, since the simplifier would collapse them anyway. 0 keeps every mesh. Geometry components can override this.
+  UPROPERTY(GlobalConfig, BlueprintReadWrite, EditAnywhere, Category = "AcousticsSettings", meta = (ClampMin = "0.0"))
+  float MinMeshSizeErrorRatio;
+
+  // Edge length in centimeters of the cells "Bake Acoustic Geometry Chunks" in the Build menu merges a level's static acoustic
+  // geometry into. Each occupied cell becomes one geometry file and one handle at runtime.
+  UPROPERTY(GlobalConfig, BlueprintReadWrite, EditAnywhere, Category = "AcousticsSettings", meta = (ClampMin = "100.0"))
+  float GeometryChunkSize;
+
   // When you bake an acoustic map, also bake all the acoustic geometry files
   UPROPERTY(GlobalConfig, BlueprintReadWrite, EditAnywhere, Category = "AcousticsSettings")
   bool bMapBakeWriteGeo;
@@ -80,6 +136,35 @@ class METAXRAUDIO_API UMetaXRAcousticProjectSettings : public UObject {
   UPROPERTY(GlobalConfig, EditAnywhere, Category = "AcousticsSettings")
   TArray<FFilePath> MapsIncludedInBulkBake;
 
+  // When cooking, store baked acoustic geometry and maps in the level packages so they load through the engine's streaming
+  // pipeline instead of as loose Content files
+  UPROPERTY(GlobalConfig, BlueprintReadWrite, EditAnywhere, Category = "AcousticsSettings", meta = (DisplayName = "Cook Baked Data Into Levels"))
+  bool bCookBakedData;
+
+  // When cooking, list the loose acoustic files each level reads in a manifest so a cooked game reads them all in parallel as the
+  // level starts loading, rather than one after another as its components begin play
+  UPROPERTY(GlobalConfig, BlueprintReadWrite, EditAnywhere, Category = "AcousticsSettings")
+  bool bCookLevelManifests;
+
+  // When cooking, pack each level's loose acoustic files into one .xrapack instead of listing them in a manifest. A level then
+  // opens one file and reads it from front to back, which suits storage that is slow to open many small files, such as Android's.
+  // The cook also copies in the files of Blueprints and other templates, which no level pack holds, so the MetaXRAcoustics folder
+  // can be removed from Additional Non-Asset Directories to Package. The cook warns while it is still staged.
+  UPROPERTY(GlobalConfig, BlueprintReadWrite, EditAnywhere, Category = "AcousticsSettings")
+  bool bCookLevelPacks;
+
+  // Store baked acoustic geometry and maps LZ4 compressed with an integrity header. Uncompressed files are still read.
+  UPROPERTY(GlobalConfig, BlueprintReadWrite, EditAnywhere, Category = "AcousticsSettings")
+  bool bCompressBakedData;
+
+  // Per platform triangle budgets that "Bake Acoustic Geometry to Budget" in the Build menu fits a level's geometry into
+  UPROPERTY(GlobalConfig, EditAnywhere, Category = "AcousticsSettings")
+  TArray<FMetaXRAcousticTriangleBudget> TriangleBudgets;
+
+  // Actor classes whose pooled acoustic geometry is built when a game level starts, so their first spawns already find handles
+  UPROPERTY(GlobalConfig, EditAnywhere, Category = "AcousticsSettings")
+  TArray<FMetaXRAcousticGeometryPoolPrewarm> PrewarmedGeometryPools;
+
  private:
   void ApplyAcousticProjectSettings();
 };
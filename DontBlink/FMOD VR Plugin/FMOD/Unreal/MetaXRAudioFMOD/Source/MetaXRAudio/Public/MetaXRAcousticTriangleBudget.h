@@ -0,0 +1,54 @@
+// (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MetaXRAcousticProjectSettings.h"
+
+class UMetaXRAcousticGeometry;
+class UWorld;
+
+#if WITH_EDITOR
+// Picks a Max Error for every file enabled acoustic geometry in a level so that, baked together, they fit a platform's
+// triangle budget. Large geometry and geometry near the level's player starts keep more detail than small, faraway geometry.
+// Each geometry's error is Scale / Weight clamped to the budget's range; Scale is bisected until the simplified triangle
+// total is as close under the budget as it gets.
+class METAXRAUDIO_API FMetaXRAcousticTriangleBudgetSolver {
+ public:
+  FMetaXRAcousticTriangleBudgetSolver(UWorld* InWorld, const FMetaXRAcousticTriangleBudget& InBudget);
+
+  // Solves, assigns Max Error, bakes every geometry and writes the report. Returns false if anything failed to bake or the
+  // budget could not be reached even at the largest allowed error.
+  bool Bake();
+
+  const FString& GetReportPath() const {
+    return ReportPath;
+  }
+
+ private:
+  struct FEntry {
+    UMetaXRAcousticGeometry* Geometry = nullptr;
+    // Diameter of the world bounds in centimeters
+    float Size = 0.0f;
+    // Distance in centimeters from the bounds to the nearest player start
+    float PlayableDistance = 0.0f;
+    // Higher keeps more detail
+    float Weight = 1.0f;
+    float MaxError = 0.0f;
+    int32 TriangleCount = 0;
+    // Triangle counts already simplified, by error in hundredths of a centimeter
+    TMap<int32, int32> TriangleCounts;
+  };
+
+  void GatherEntries();
+  float GetMaxError(const FEntry& Entry, float Scale) const;
+  int32 CountTriangles(FEntry& Entry, float InMaxError);
+  int64 CountTotalTriangles(float Scale);
+  bool WriteReport(bool bWithinBudget);
+
+  UWorld* World;
+  FMetaXRAcousticTriangleBudget Budget;
+  TArray<FEntry> Entries;
+  FString ReportPath;
+};
+#endif // WITH_EDITOR
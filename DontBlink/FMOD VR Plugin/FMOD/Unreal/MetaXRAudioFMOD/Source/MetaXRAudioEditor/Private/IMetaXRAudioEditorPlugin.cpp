@@ -6,6 +6,7 @@
 #include "MetaXRAcousticControlZone.h"
 #include "MetaXRAcousticControlZoneVisualizer.h"
 #include "MetaXRAcousticGeometry.h"
+#include "MetaXRAcousticGeometryChunk.h"
 #include "MetaXRAcousticGeometryDetails.h"
 #include "MetaXRAcousticMap.h"
 #include "MetaXRAcousticMapDetails.h"
@@ -13,6 +14,7 @@
 #include "MetaXRAcousticMaterialDetails.h"
 #include "MetaXRAcousticMaterialPropertiesFactory.h"
 #include "MetaXRAcousticProjectSettings.h"
+#include "MetaXRAcousticTriangleBudget.h"
 #include "MetaXRAudioEditorInfo.h"
 #include "MetaXRAudioEditorMode.h"
 #include "MetaXRAudioPlatform.h"
@@ -206,6 +208,81 @@ void FMetaXRAudioEditorPlugin::StartupModule() {
       FSlateIcon(),
       ActionBulkBake,
       EUserInterfaceActionType::Button);
+
+  // One entry per triangle budget in the project settings, read each time the menu opens so edits show up straight away
+  BuildSection.AddSubMenu(
+      "MetaXRAudioBudgetBake",
+      LOCTEXT("MetaXRAudioBudgetBakeTitle", "Bake Acoustic Geometry to Budget"),
+      LOCTEXT(
+          "MetaXRAudioBudgetBakeTooltip",
+          "Chooses the Max Error of every acoustic geometry in the level to fit a platform's triangle budget, then bakes them and "
+          "writes a report to the Saved folder"),
+      FNewToolMenuDelegate::CreateLambda([](UToolMenu* SubMenu) {
+        FToolMenuSection& BudgetSection = SubMenu->AddSection("MetaXRAudioBudgets");
+        const UMetaXRAcousticProjectSettings* Settings = GetDefault<UMetaXRAcousticProjectSettings>();
+        if (Settings->TriangleBudgets.IsEmpty()) {
+          BudgetSection.AddMenuEntry(
+              NAME_None,
+              LOCTEXT("MetaXRAudioNoBudgetsTitle", "No triangle budgets in the Meta XR Acoustics project settings"),
+              FText::GetEmpty(),
+              FSlateIcon(),
+              FUIAction(FExecuteAction(), FCanExecuteAction::CreateLambda([]() { return false; })));
+          return;
+        }
+
+        for (int32 BudgetIndex = 0; BudgetIndex < Settings->TriangleBudgets.Num(); ++BudgetIndex) {
+          const FMetaXRAcousticTriangleBudget& Budget = Settings->TriangleBudgets[BudgetIndex];
+          FUIAction ActionBudgetBake(FExecuteAction::CreateLambda([BudgetIndex]() {
+            const UMetaXRAcousticProjectSettings* BakeSettings = GetDefault<UMetaXRAcousticProjectSettings>();
+            UWorld* World = GEditor->GetEditorWorldContext().World();
+            if (World == nullptr || !BakeSettings->TriangleBudgets.IsValidIndex(BudgetIndex))
+              return;
+
+            FMetaXRAcousticTriangleBudgetSolver Solver(World, BakeSettings->TriangleBudgets[BudgetIndex]);
+            if (!Solver.Bake())
+              UE_LOG(LogAudio, Warning, TEXT("Baking acoustic geometry to the triangle budget did not fully succeed"));
+          }));
+          BudgetSection.AddMenuEntry(
+              NAME_None,
+              FText::Format(
+                  LOCTEXT("MetaXRAudioBudgetEntryTitle", "{0} ({1} triangles)"),
+                  FText::FromString(Budget.Platform),
+                  FText::AsNumber(Budget.MaxTriangles)),
+              FText::GetEmpty(),
+              FSlateIcon(),
+              ActionBudgetBake);
+        }
+      }));
+
+  FUIAction ActionChunkBake(FExecuteAction::CreateLambda([]() {
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (World != nullptr && !AMetaXRAcousticGeometryChunk::BakeLevel(World))
+      UE_LOG(LogAudio, Warning, TEXT("Baking acoustic geometry chunks did not fully succeed"));
+  }));
+  BuildSection.AddMenuEntry(
+      NAME_None,
+      LOCTEXT("MetaXRAudioChunkBakeTitle", "Bake Acoustic Geometry Chunks"),
+      LOCTEXT(
+          "MetaXRAudioChunkBakeTooltip",
+          "Merges the static acoustic geometry of the current level into cells of the project's Geometry Chunk Size and bakes one "
+          "file per cell"),
+      FSlateIcon(),
+      ActionChunkBake,
+      EUserInterfaceActionType::Button);
+
+  FUIAction ActionChunkRemove(FExecuteAction::CreateLambda([]() {
+    if (UWorld* World = GEditor->GetEditorWorldContext().World())
+      AMetaXRAcousticGeometryChunk::RemoveFromLevel(World);
+  }));
+  BuildSection.AddMenuEntry(
+      NAME_None,
+      LOCTEXT("MetaXRAudioChunkRemoveTitle", "Remove Acoustic Geometry Chunks"),
+      LOCTEXT(
+          "MetaXRAudioChunkRemoveTooltip",
+          "Deletes the current level's acoustic geometry chunks so the merged geometry loads its own files again"),
+      FSlateIcon(),
+      ActionChunkRemove,
+      EUserInterfaceActionType::Button);
 #undef LOCTEXT_NAMESPACE
 }
 
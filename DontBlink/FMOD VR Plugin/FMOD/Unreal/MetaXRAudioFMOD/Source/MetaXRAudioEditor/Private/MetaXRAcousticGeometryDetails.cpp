@@ -176,6 +176,53 @@ void FMetaXRAcousticGeometryDetails::CustomizeDetails(IDetailLayoutBuilder& Deta
                                 EditedComponent->LOD = FMath::Max(FMath::Min(Value, 7), 0);
                               })];
 
+  // The remaining bake options use their default property widgets, which honor their edit conditions
+  MeshSimplificationControlsGroup.AddPropertyRow(
+      DetailBuilder.GetProperty(GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, GeometrySource)));
+
+  for (const FName PropertyName :
+       {GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, bCleanMesh), GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, WeldTolerance)})
+    MeshSimplificationControlsGroup.AddPropertyRow(DetailBuilder.GetProperty(PropertyName));
+
+  for (const FName PropertyName :
+       {GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, bCullInteriorFaces),
+        GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, InteriorCullVoxelSize),
+        GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, ReachabilitySeeds)})
+    MeshSimplificationControlsGroup.AddPropertyRow(DetailBuilder.GetProperty(PropertyName));
+
+  for (const FName PropertyName :
+       {GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, bVoxelShell), GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, VoxelShellSize)})
+    MeshSimplificationControlsGroup.AddPropertyRow(DetailBuilder.GetProperty(PropertyName));
+
+  for (const FName PropertyName :
+       {GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, DistantErrorLevels),
+        GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, ErrorLevelHysteresis)})
+    MeshSimplificationControlsGroup.AddPropertyRow(DetailBuilder.GetProperty(PropertyName));
+
+  IDetailGroup& InstancedMeshControlsGroup = AdvancedControlsGroup.AddGroup("Instanced Meshes", FText::FromString("Instanced Meshes"));
+  InstancedMeshControlsGroup.AddPropertyRow(
+      DetailBuilder.GetProperty(GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, bSimplifyInstancesOnce)));
+
+  for (const FName PropertyName :
+       {GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, InstanceProxy),
+        GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, InstanceProxyClusterSize),
+        GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, InstanceProxyMaterial)})
+    InstancedMeshControlsGroup.AddPropertyRow(DetailBuilder.GetProperty(PropertyName));
+
+  IDetailGroup& SignificanceControlsGroup = AdvancedControlsGroup.AddGroup("Significance", FText::FromString("Significance"));
+  for (const FName PropertyName :
+       {GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, bOverrideSignificance),
+        GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, MinMeshSize),
+        GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, MinMeshSizeErrorRatio)})
+    SignificanceControlsGroup.AddPropertyRow(DetailBuilder.GetProperty(PropertyName));
+
+  IDetailGroup& PoolingControlsGroup = AdvancedControlsGroup.AddGroup("Pooling", FText::FromString("Pooling"));
+  for (const FName PropertyName :
+       {GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, bPoolGeometry), GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, PoolSize)})
+    PoolingControlsGroup.AddPropertyRow(DetailBuilder.GetProperty(PropertyName));
+
+  AdvancedControlsGroup.AddPropertyRow(DetailBuilder.GetProperty(GET_MEMBER_NAME_CHECKED(UMetaXRAcousticGeometry, bMergedIntoChunk)));
+
   this->FilePathEditableTextBox =
       SNew(SEditableTextBox)
           .OnKeyDownHandler_Lambda([this, EditedComponent](const FGeometry& Geo, const FKeyEvent& KeyEvent) -> FReply {
@@ -240,6 +287,16 @@ void FMetaXRAcousticGeometryDetails::CustomizeDetails(IDetailLayoutBuilder& Deta
         return FText::AsNumber(GizmoVertCount);
       })];
 
+  Category.AddCustomRow(FText::FromString("Skipped Meshes"))
+      .NameContent()[SNew(STextBlock)
+                         .Text(FText::FromString("Skipped Meshes"))
+                         .ToolTipText(FText::FromString(
+                             "The number of static meshes left out for being smaller than the significance threshold"))]
+      .ValueContent()
+      .HAlign(HAlign_Left)[SNew(STextBlock).Text_Lambda([EditedComponent]() {
+        return FText::AsNumber(EditedComponent->SkippedMeshCount);
+      })];
+
   Category.AddCustomRow(FText::FromString("File Size"))
       .NameContent()
           [SNew(STextBlock).Text(FText::FromString("Size")).ToolTipText(FText::FromString("The total size of the serialized data"))]